@@ -0,0 +1,90 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : ipslbitmapcache.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Plug-in Bitmap Cache Interface
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _ipslbitmapcache_h
+#define _ipslbitmapcache_h
+
+#include "pluginterfaces/base/funknown.h"
+#include "pluginterfaces/base/falignpush.h"
+
+namespace Presonus {
+
+struct BitmapPixelBuffer;
+struct IBitmapAccessor;
+
+//************************************************************************************************
+// IPlugBitmapCacheFrame
+/**	Host-owned cache for prerendered bitmaps, shared between all instances of a plug-in class.
+	Implemented by the host as extension of IPlugFrame.
+
+	Plug-ins rasterizing vector assets (knob strips, backgrounds, etc.) for the current content scale
+	factor (see IPlugInViewScaling) can store the results here, so that other instances of the same
+	plug-in class don't have to rasterize them again. Entries are identified by an asset identifier
+	chosen by the plug-in and the scale factor. Scale factors are compared exactly, i.e. the plug-in
+	should pass the factor it received via setContentScaleFactor(). The asset identifier should
+	include a version if assets can change between plug-in versions.
+
+	The host may discard entries at any time, e.g. under memory pressure, but not while a bitmap
+	returned by getBitmap() is still referenced. Pixel formats are those of BitmapPixelBuffer.
+
+	Usage Example:
+
+	@code{.cpp}
+		IBitmapAccessor* bitmap = nullptr;
+		if(bitmapCache->getBitmap ("knob.v3", scaleFactor, &bitmap) == kResultOk)
+		{
+			{
+				BitmapLockScope scope (bitmap);
+				if(scope.result == kResultOk)
+					drawKnobStrip (scope.data);
+			}
+			bitmap->release ();
+		}
+		else
+		{
+			BitmapPixelBuffer pixels = renderKnobStrip (scaleFactor);
+			bitmapCache->storeBitmap ("knob.v3", scaleFactor, &pixels);
+			drawKnobStrip (pixels);
+		}
+	@endcode
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugBitmapCacheFrame: Steinberg::FUnknown
+{
+	/**	Get cached bitmap. The returned accessor has to be released by the caller. Its pixels must not be modified.
+		\return kResultOk if the bitmap is in the cache, kResultFalse otherwise */
+	virtual Steinberg::tresult PLUGIN_API getBitmap (Steinberg::FIDString assetId, float scaleFactor, IBitmapAccessor** bitmap) = 0;
+
+	/** Store a copy of given pixels in the cache, replacing an existing entry with the same identifier and scale factor. */
+	virtual Steinberg::tresult PLUGIN_API storeBitmap (Steinberg::FIDString assetId, float scaleFactor, const BitmapPixelBuffer* pixels) = 0;
+
+	/** Remove all entries with given identifier for all scale factors, or all entries of the plug-in class if assetId is null. */
+	virtual Steinberg::tresult PLUGIN_API removeBitmaps (Steinberg::FIDString assetId) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugBitmapCacheFrame, 0x9d7912c5, 0xc70c4c7f, 0xac063835, 0xee17f562)
+
+} // namespace Presonus
+
+#include "pluginterfaces/base/falignpop.h"
+
+#endif // _ipslbitmapcache_h
\ No newline at end of file
@@ -4,7 +4,7 @@
 // Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
 //
 // Filename    : ipslspeakerinfo.h
-// Created by  : PreSonus Software Ltd., 04/2024
+// Created by  : PreSonus Software Ltd., 04/2024, last updated 10/2026
 // Description : Speaker Arrangement Support Info Interface
 //
 //************************************************************************************************
@@ -20,6 +20,7 @@
 #define _ipslspeakerinfo_h
 
 #include "pluginterfaces/vst/vsttypes.h"
+#include "pluginterfaces/vst/vstspeaker.h"
 #include "pluginterfaces/base/funknown.h"
 #include "pluginterfaces/base/falignpush.h"
 
@@ -45,6 +46,48 @@ struct ISpeakerSupportInfo: Steinberg::FUnknown
 
 DECLARE_CLASS_IID (ISpeakerSupportInfo, 0x7342e0eb, 0x8f5641de, 0xa5f7c503, 0x8e2ec3ef)
 
+//************************************************************************************************
+// ISpeakerSupportInfo2
+/**	Extension to ISpeakerSupportInfo to query support for a list of speaker arrangements on all
+	buses of one direction with a single call.
+	- Implemented by plug-in as extension of Steinberg::Vst::IComponent
+
+	The result is a bit mask per bus: bit n of supportMasks[busIndex] is set if arrangements[n] is
+	supported on that bus. Hosts may cache the result until the plug-in signals a change via
+	ISpeakerSupportHandler::notifySpeakerSupportChanged().
+
+	Usage Example:
+
+	@code{.cpp}
+		const int32 kMaxBuses = 16;
+		SpeakerArrangement candidates[] = {SpeakerArr::kStereo, SpeakerArr::k51, SpeakerArr::k71_4};
+		uint64 masks[kMaxBuses] = {0};
+		int32 busCount = std::min (component->getBusCount (kAudio, kOutput), kMaxBuses);
+		if(busCount > 0 && speakerSupportInfo2->getArrangementSupport (kOutput, candidates, 3, masks, busCount) == kResultOk)
+		{
+			bool mainBusSupports714 = (masks[0] & (uint64 (1) << 2)) != 0;
+		}
+	@endcode
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct ISpeakerSupportInfo2: ISpeakerSupportInfo
+{
+	/** Maximum number of speaker arrangements per call (number of bits in a support mask). */
+	static const Steinberg::int32 kMaxArrangementsPerQuery = 64;
+
+	/**	Report support for given speaker arrangements on the first numBuses buses of the given direction.
+		numArrangements must not exceed kMaxArrangementsPerQuery, supportMasks must provide space for numBuses entries.
+		\return kResultOk on success, kInvalidArgument if the counts are out of range */
+	virtual Steinberg::tresult PLUGIN_API getArrangementSupport (Steinberg::Vst::BusDirection dir, const Steinberg::Vst::SpeakerArrangement* arrangements, Steinberg::int32 numArrangements,
+																 Steinberg::uint64* supportMasks, Steinberg::int32 numBuses) = 0;
+
+    static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISpeakerSupportInfo2, 0x05ed217b, 0x86c14598, 0xbd363170, 0xbc22c97b)
+
 //************************************************************************************************
 // ISpeakerArrangementHostInfo
 /**	Interface to query information about speaker arrangement support.	
@@ -63,6 +106,507 @@ struct ISpeakerSupportHostInfo: Steinberg::FUnknown
 
 DECLARE_CLASS_IID (ISpeakerSupportHostInfo, 0x3327e14a, 0x055e4d27, 0x9a0f6b4a, 0x36316e7b)
 
+//************************************************************************************************
+// ISpeakerSupportHandler
+/**	Notification interface for changes of speaker arrangement support.
+	- Implemented by host as extension of Steinberg::Vst::IComponentHandler.
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct ISpeakerSupportHandler: Steinberg::FUnknown
+{
+	/**	Notify the host that the set of supported speaker arrangements has changed, e.g. after
+		loading a preset which switches the internal processing mode. The host should discard
+		cached results of ISpeakerSupportInfo and ISpeakerSupportInfo2. Must be called in the main thread. */
+	virtual Steinberg::tresult PLUGIN_API notifySpeakerSupportChanged () = 0;
+
+    static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISpeakerSupportHandler, 0x15ced416, 0x66f84258, 0x82d0ee71, 0x364e9bf9)
+
+//************************************************************************************************
+// ISpeakerChannelOrderInfo
+/**	Interface to query the channel order expected by the plug-in for a speaker arrangement.
+	- Implemented by plug-in as extension of Steinberg::Vst::IComponent
+
+	Plug-ins which use a different channel order internally, e.g. to match an external renderer,
+	can report it here instead of shuffling audio data on every process call. A host supporting this
+	interface passes the channel buffers in this order (see SpeakerChannelMap). As channel buffers are
+	passed by pointer, this doesn't require copying any audio data.
+
+	The reported order is only used after the host has confirmed it via setChannelOrderApplied().
+	Hosts which don't know this interface (including older versions of Studio One) keep passing
+	channels in standard order, so the plug-in must process standard order unless it has been told
+	otherwise. Confirmations are given per bus and arrangement: the plug-in uses the reported order
+	for a bus only while its current arrangement is one the host has confirmed for that bus. Hosts
+	confirm after IAudioProcessor::setBusArrangements() and before processing starts. Hosts using
+	ISpeakerArrangementSwitching confirm all arrangements they may switch to before processing starts.
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct ISpeakerChannelOrderInfo: Steinberg::FUnknown
+{
+	/**	Get the channel order for given arrangement on a specific bus. speakers must provide space
+		for numChannels entries, each speaker of the arrangement has to be reported exactly once.
+		\return kResultOk if the order has been reported, kResultFalse if the standard order is used */
+	virtual Steinberg::tresult PLUGIN_API getChannelOrder (Steinberg::Vst::SpeakerArrangement arr, Steinberg::Vst::BusDirection dir, Steinberg::int32 index,
+														   Steinberg::Vst::Speaker* speakers, Steinberg::int32 numChannels) = 0;
+
+	/**	Called by the host to confirm whether channel buffers of the given bus are passed in the order reported
+		by getChannelOrder() (state true) or in standard order (state false) while the bus has the given arrangement.
+		Called in the main thread while the plug-in is not processing. */
+	virtual Steinberg::tresult PLUGIN_API setChannelOrderApplied (Steinberg::Vst::SpeakerArrangement arr, Steinberg::Vst::BusDirection dir, Steinberg::int32 index,
+																  Steinberg::TBool state) = 0;
+
+    static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISpeakerChannelOrderInfo, 0x4490f6e2, 0xb76f4083, 0xbc1fbe67, 0xcddcb3a4)
+
+//************************************************************************************************
+// ISpeakerArrangementSwitching
+/**	Interface to switch bus arrangements without deactivating the plug-in.
+	- Implemented by plug-in as extension of Steinberg::Vst::IAudioProcessor
+
+	Changing arrangements via IAudioProcessor::setBusArrangements() requires the host to deactivate
+	the plug-in and to set up processing again. With this interface the plug-in is prepared for the
+	largest arrangements in advance, so the host can switch between them while processing stays
+	set up, e.g. when changing the monitoring format of an immersive mix.
+
+	Call sequence:
+	- setBusArrangements() with the initial arrangements, as usual
+	- setMaxBusArrangements() with the largest arrangements the host might switch to.
+	  The plug-in allocates buffers for these. A result other than kResultOk means that
+	  switching is not supported and the host uses setBusArrangements() as usual.
+	- setupProcessing(), setActive (true), setProcessing (true)
+	- canSwitchBusArrangements() in the main thread to check if the plug-in can switch to new
+	  arrangements, i.e. if they are supported (see ISpeakerSupportInfo) and don't exceed the
+	  arrangements passed to setMaxBusArrangements().
+	- switchBusArrangements() in the processing thread between two process() calls. Afterwards
+	  IAudioProcessor::getBusArrangement() reports the new arrangements and the next process()
+	  call uses the new channel counts.
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct ISpeakerArrangementSwitching: Steinberg::FUnknown
+{
+	/**	Prepare for switching up to the given arrangements. Called in the main thread while the plug-in is inactive.
+		Every arrangement passed to switchBusArrangements() later has to be a subset of the arrangement for the same bus given here.
+		\return kResultOk if arrangements can be switched without deactivation */
+	virtual Steinberg::tresult PLUGIN_API setMaxBusArrangements (Steinberg::Vst::SpeakerArrangement* inputs, Steinberg::int32 numIns,
+																 Steinberg::Vst::SpeakerArrangement* outputs, Steinberg::int32 numOuts) = 0;
+
+	/**	Check if the plug-in can switch to given arrangements while processing. Called in the main thread.
+		\return kResultTrue if switchBusArrangements() will succeed for these arrangements */
+	virtual Steinberg::tresult PLUGIN_API canSwitchBusArrangements (Steinberg::Vst::SpeakerArrangement* inputs, Steinberg::int32 numIns,
+																	Steinberg::Vst::SpeakerArrangement* outputs, Steinberg::int32 numOuts) = 0;
+
+	/**	Switch to given arrangements. Called in the processing thread between two process() calls, the implementation
+		must not allocate memory or block. Internal state depending on the channel layout (e.g. delay lines, filter
+		states) should be reset or mapped to the new layout. \return kResultOk on success, the host falls back to
+		deactivating the plug-in and calling setBusArrangements() otherwise */
+	virtual Steinberg::tresult PLUGIN_API switchBusArrangements (Steinberg::Vst::SpeakerArrangement* inputs, Steinberg::int32 numIns,
+																 Steinberg::Vst::SpeakerArrangement* outputs, Steinberg::int32 numOuts) = 0;
+
+    static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISpeakerArrangementSwitching, 0x477d4fbd, 0xf58444f5, 0xa69ea6b0, 0x7300adb7)
+
+//************************************************************************************************
+// SpeakerChannelMap
+/**	Helper to reorder channel buffers from the standard order of a speaker arrangement to the
+	order reported via ISpeakerChannelOrderInfo. The map is computed once when the arrangement
+	is set. Reordering works in place on the array of channel buffer pointers, i.e.
+	Steinberg::Vst::AudioBusBuffers::channelBuffers32 or channelBuffers64, and doesn't allocate.
+
+	Usage Example:
+
+	@code{.cpp}
+		// after setBusArrangements()
+		Speaker order[SpeakerChannelMap::kMaxChannels];
+		int32 numChannels = SpeakerArr::getChannelCount (arr);
+		if(channelOrderInfo->getChannelOrder (arr, kOutput, 0, order, numChannels) == kResultOk)
+		{
+			channelMap.build (arr, order, numChannels);
+			channelOrderInfo->setChannelOrderApplied (arr, kOutput, 0, true);
+		}
+
+		// per process call
+		channelMap.apply (outputs[0].channelBuffers32);
+		outputs[0].silenceFlags = channelMap.mapFlags (outputs[0].silenceFlags);
+		processor->process (data);
+		channelMap.applyInverse (outputs[0].channelBuffers32);
+		outputs[0].silenceFlags = channelMap.unmapFlags (outputs[0].silenceFlags);
+	@endcode
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct SpeakerChannelMap
+{
+	static const Steinberg::int32 kMaxChannels = 64;
+
+	Steinberg::int32 count;
+	Steinberg::int8 sourceIndex[kMaxChannels];	///< index in standard order for each channel in reported order
+
+	SpeakerChannelMap (): count (0) {}
+
+	/** Reset to identity. */
+	void clear () { count = 0; }
+
+	/** Build map from reported channel order. \return false if order doesn't match the arrangement */
+	bool build (Steinberg::Vst::SpeakerArrangement arr, const Steinberg::Vst::Speaker* order, Steinberg::int32 numChannels)
+	{
+		count = 0;
+		if(numChannels != Steinberg::Vst::SpeakerArr::getChannelCount (arr) || numChannels > kMaxChannels)
+			return false;
+
+		Steinberg::Vst::SpeakerArrangement remaining = arr;
+		for(Steinberg::int32 i = 0; i < numChannels; i++)
+		{
+			if((remaining & order[i]) == 0 || Steinberg::Vst::SpeakerArr::getChannelCount (order[i]) != 1)
+				return false;
+			remaining &= ~order[i];
+			sourceIndex[i] = Steinberg::int8 (Steinberg::Vst::SpeakerArr::getSpeakerIndex (order[i], arr));
+		}
+
+		count = numChannels;
+		if(isIdentity ())
+			count = 0;
+		return true;
+	}
+
+	/** Check if channels are in standard order. */
+	bool isIdentity () const
+	{
+		for(Steinberg::int32 i = 0; i < count; i++)
+			if(sourceIndex[i] != i)
+				return false;
+		return true;
+	}
+
+	/** Reorder channel buffers from standard order to reported order. */
+	template<class T> void apply (T** channels) const
+	{
+		if(count == 0)
+			return;
+		T* temp[kMaxChannels];
+		for(Steinberg::int32 i = 0; i < count; i++)
+			temp[i] = channels[i];
+		for(Steinberg::int32 i = 0; i < count; i++)
+			channels[i] = temp[sourceIndex[i]];
+	}
+
+	/** Reorder channel buffers from reported order back to standard order. */
+	template<class T> void applyInverse (T** channels) const
+	{
+		if(count == 0)
+			return;
+		T* temp[kMaxChannels];
+		for(Steinberg::int32 i = 0; i < count; i++)
+			temp[i] = channels[i];
+		for(Steinberg::int32 i = 0; i < count; i++)
+			channels[sourceIndex[i]] = temp[i];
+	}
+
+	/** Reorder per-channel bit flags (e.g. silence flags) from standard order to reported order. */
+	Steinberg::uint64 mapFlags (Steinberg::uint64 flags) const
+	{
+		if(count == 0)
+			return flags;
+		Steinberg::uint64 result = 0;
+		for(Steinberg::int32 i = 0; i < count; i++)
+			if(flags & (Steinberg::uint64 (1) << sourceIndex[i]))
+				result |= Steinberg::uint64 (1) << i;
+		return result;
+	}
+
+	/** Reorder per-channel bit flags from reported order back to standard order. */
+	Steinberg::uint64 unmapFlags (Steinberg::uint64 flags) const
+	{
+		if(count == 0)
+			return flags;
+		Steinberg::uint64 result = 0;
+		for(Steinberg::int32 i = 0; i < count; i++)
+			if(flags & (Steinberg::uint64 (1) << i))
+				result |= Steinberg::uint64 (1) << sourceIndex[i];
+		return result;
+	}
+};
+
+//************************************************************************************************
+// ISpeakerConversionInfo
+/**	Interface to query preferred conversion matrices between speaker arrangements.
+	- Implemented by plug-in as extension of Steinberg::Vst::IComponent
+
+	If a bus doesn't support the arrangement used by the host (see ISpeakerSupportInfo), the host
+	has to convert between the two arrangements before and/or after the plug-in. A plug-in can
+	report its own up- or downmix matrix here, e.g. to match the conversion it would apply
+	internally. The host applies the matrix instead of its generic conversion (see SpeakerConversionMatrix).
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct ISpeakerConversionInfo: Steinberg::FUnknown
+{
+	/**	Get the matrix to convert from one arrangement to another. Coefficients are linear gain factors
+		stored row by row, i.e. coefficients[outChannel * numInputChannels + inChannel], using the
+		standard channel order of both arrangements. numCoefficients is the product of both channel counts.
+		\return kResultOk if a matrix has been reported, kResultFalse if the host should use its own conversion */
+	virtual Steinberg::tresult PLUGIN_API getConversionMatrix (Steinberg::Vst::SpeakerArrangement from, Steinberg::Vst::SpeakerArrangement to,
+															   float* coefficients, Steinberg::int32 numCoefficients) = 0;
+
+    static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISpeakerConversionInfo, 0x8205a715, 0x62764fe3, 0xa6535b40, 0x91d573ae)
+
+//************************************************************************************************
+// SpeakerConversionMatrix
+/**	Helper for hosts to apply a conversion matrix reported via ISpeakerConversionInfo.
+	Zero coefficients are skipped, so that sparse up- and downmix matrices only cost one
+	multiply-add per sample for each non-zero coefficient. The inner loops run over contiguous
+	samples and can be vectorized by the compiler. Processing doesn't allocate.
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+struct SpeakerConversionMatrix
+{
+	static const Steinberg::int32 kMaxChannels = 64;
+
+	Steinberg::int32 numInputs;
+	Steinberg::int32 numOutputs;
+	float coefficients[kMaxChannels * kMaxChannels];
+
+	SpeakerConversionMatrix (): numInputs (0), numOutputs (0) {}
+
+	/** Query matrix from plug-in. \return kResultOk if the plug-in provides a matrix for given arrangements */
+	Steinberg::tresult init (ISpeakerConversionInfo* info, Steinberg::Vst::SpeakerArrangement from, Steinberg::Vst::SpeakerArrangement to)
+	{
+		numInputs = Steinberg::Vst::SpeakerArr::getChannelCount (from);
+		numOutputs = Steinberg::Vst::SpeakerArr::getChannelCount (to);
+		if(info == nullptr || numInputs > kMaxChannels || numOutputs > kMaxChannels)
+		{
+			numInputs = numOutputs = 0;
+			return Steinberg::kResultFalse;
+		}
+
+		Steinberg::int32 numCoefficients = numInputs * numOutputs;
+		for(Steinberg::int32 i = 0; i < numCoefficients; i++)
+			coefficients[i] = 0.f;
+
+		Steinberg::tresult result = info->getConversionMatrix (from, to, coefficients, numCoefficients);
+		if(result != Steinberg::kResultOk)
+			numInputs = numOutputs = 0;
+		return result;
+	}
+
+	/** Check if a matrix is available. */
+	bool isValid () const { return numInputs > 0 && numOutputs > 0; }
+
+	/** Convert numSamples of input channels to output channels. Input and output buffers must not overlap. */
+	template<class T> void process (T** inputs, T** outputs, Steinberg::int32 numSamples) const
+	{
+		for(Steinberg::int32 out = 0; out < numOutputs; out++)
+		{
+			const float* row = coefficients + out * numInputs;
+			T* dst = outputs[out];
+			bool cleared = false;
+			for(Steinberg::int32 in = 0; in < numInputs; in++)
+			{
+				const T gain = T (row[in]);
+				if(gain == T (0))
+					continue;
+
+				const T* src = inputs[in];
+				if(cleared == false)
+				{
+					for(Steinberg::int32 s = 0; s < numSamples; s++)
+						dst[s] = src[s] * gain;
+					cleared = true;
+				}
+				else
+				{
+					for(Steinberg::int32 s = 0; s < numSamples; s++)
+						dst[s] += src[s] * gain;
+				}
+			}
+
+			if(cleared == false)
+				for(Steinberg::int32 s = 0; s < numSamples; s++)
+					dst[s] = T (0);
+		}
+	}
+};
+
+//************************************************************************************************
+// SpeakerArrangementNegotiation
+/**	Helper for hosts to resolve speaker arrangements for all inserts of an effect chain.
+
+	The host passes a list of candidate arrangements (ordered by preference) once via setCandidates().
+	For each chain it passes the arrangement feeding the chain (source), the arrangement expected after
+	the chain (target) and one mask per insert with bit n set if candidates[n] is supported on the main
+	input and output bus of the insert (see ISpeakerSupportInfo2). The result is the index of the
+	candidate to use for each insert, or -1 for inserts that do not support any of the candidates and
+	are therefore left out of the negotiation.
+
+	The chosen arrangements minimize the number of format conversions (up- or downmixes) along the
+	chain. Between solutions with the same number of conversions, the one losing the fewest speakers
+	in total is preferred, then the one adding the fewest speakers in total. Remaining ties are resolved
+	in favor of earlier candidates.
+
+	Conversion costs between candidates are computed once in setCandidates(), so that a single instance
+	can be used to negotiate many chains. negotiate() doesn't allocate memory and runs in
+	O(inserts x candidates^2).
+
+	@ingroup speakerInfo */
+//************************************************************************************************
+
+template<Steinberg::int32 maxInserts = 64>
+class SpeakerArrangementNegotiation
+{
+public:
+	static const Steinberg::int32 kMaxInserts = maxInserts;
+	static const Steinberg::int32 kMaxCandidates = ISpeakerSupportInfo2::kMaxArrangementsPerQuery;
+
+	// Costs are weighted so that the totals of a chain compare lexicographically: a chain has at most
+	// kMaxInserts + 1 conversions with at most 64 lost or added speakers each, so the sum of all lower
+	// ranked costs is always below the cost of a single higher ranked item.
+	static const Steinberg::int64 kMaxSpeakerChanges = (kMaxInserts + 1) * 64;
+	static const Steinberg::int64 kAddedSpeakerCost = 1;											///< cost per speaker added by an upmix
+	static const Steinberg::int64 kLostSpeakerCost = (kMaxSpeakerChanges + 1) * kAddedSpeakerCost;	///< cost per speaker lost by a downmix
+	static const Steinberg::int64 kConversionCost = (kMaxSpeakerChanges + 1) * kLostSpeakerCost;	///< cost of any conversion
+
+	/** Get cost of converting between two speaker arrangements, zero if both are equal. */
+	static Steinberg::int64 getConversionCost (Steinberg::Vst::SpeakerArrangement from, Steinberg::Vst::SpeakerArrangement to)
+	{
+		if(from == to)
+			return 0;
+		Steinberg::int32 lost = Steinberg::Vst::SpeakerArr::getChannelCount (from & ~to);
+		Steinberg::int32 added = Steinberg::Vst::SpeakerArr::getChannelCount (to & ~from);
+		return kConversionCost + lost * kLostSpeakerCost + added * kAddedSpeakerCost;
+	}
+
+	SpeakerArrangementNegotiation ()
+	: numCandidates (0)
+	{}
+
+	/** Set candidate arrangements in order of preference. \return kInvalidArgument if more than kMaxCandidates */
+	Steinberg::tresult setCandidates (const Steinberg::Vst::SpeakerArrangement* arrangements, Steinberg::int32 count)
+	{
+		if(count < 0 || count > kMaxCandidates)
+			return Steinberg::kInvalidArgument;
+
+		numCandidates = count;
+		for(Steinberg::int32 i = 0; i < count; i++)
+			candidates[i] = arrangements[i];
+
+		for(Steinberg::int32 from = 0; from < count; from++)
+			for(Steinberg::int32 to = 0; to < count; to++)
+				conversionCosts[from][to] = getConversionCost (candidates[from], candidates[to]);
+		return Steinberg::kResultOk;
+	}
+
+	/**	Negotiate arrangements for a chain of numInserts inserts. result must provide space for numInserts entries.
+		\return kResultOk on success, kInvalidArgument if numInserts exceeds kMaxInserts */
+	Steinberg::tresult negotiate (const Steinberg::uint64* insertMasks, Steinberg::int32 numInserts,
+								  Steinberg::Vst::SpeakerArrangement source, Steinberg::Vst::SpeakerArrangement target,
+								  Steinberg::int32* result)
+	{
+		if(numInserts < 0 || numInserts > kMaxInserts)
+			return Steinberg::kInvalidArgument;
+
+		// states 0..numCandidates-1 are the candidates, state numCandidates is the unchanged source
+		const Steinberg::int32 sourceState = numCandidates;
+		const Steinberg::uint64 candidateMask = numCandidates < 64 ? (Steinberg::uint64 (1) << numCandidates) - 1 : ~Steinberg::uint64 (0);
+
+		for(Steinberg::int32 k = 0; k < numCandidates; k++)
+			conversionCosts[sourceState][k] = getConversionCost (source, candidates[k]);
+
+		Steinberg::int64 costs[kMaxCandidates + 1];
+		Steinberg::int64 nextCosts[kMaxCandidates + 1];
+		for(Steinberg::int32 k = 0; k < numCandidates; k++)
+			costs[k] = kUnreachable;
+		costs[sourceState] = 0;
+
+		for(Steinberg::int32 i = 0; i < numInserts; i++)
+		{
+			Steinberg::uint64 mask = insertMasks[i] & candidateMask;
+			if(mask == 0)
+			{
+				for(Steinberg::int32 k = 0; k <= numCandidates; k++)
+					previousStates[i][k] = Steinberg::int8 (k);
+				continue;
+			}
+
+			for(Steinberg::int32 k = 0; k <= numCandidates; k++)
+				nextCosts[k] = kUnreachable;
+
+			for(Steinberg::int32 k = 0; k < numCandidates; k++)
+			{
+				if((mask & (Steinberg::uint64 (1) << k)) == 0)
+					continue;
+
+				for(Steinberg::int32 j = 0; j <= numCandidates; j++)
+				{
+					if(costs[j] == kUnreachable)
+						continue;
+					Steinberg::int64 cost = costs[j] + conversionCosts[j][k];
+					if(cost < nextCosts[k])
+					{
+						nextCosts[k] = cost;
+						previousStates[i][k] = Steinberg::int8 (j);
+					}
+				}
+			}
+
+			for(Steinberg::int32 k = 0; k <= numCandidates; k++)
+				costs[k] = nextCosts[k];
+		}
+
+		Steinberg::int32 bestState = sourceState;
+		Steinberg::int64 bestCost = kUnreachable;
+		for(Steinberg::int32 k = 0; k <= numCandidates; k++)
+		{
+			if(costs[k] == kUnreachable)
+				continue;
+			Steinberg::int64 cost = costs[k] + getConversionCost (k == sourceState ? source : candidates[k], target);
+			if(cost < bestCost)
+			{
+				bestCost = cost;
+				bestState = k;
+			}
+		}
+
+		for(Steinberg::int32 i = numInserts - 1; i >= 0; i--)
+		{
+			result[i] = (insertMasks[i] & candidateMask) ? bestState : -1;
+			bestState = previousStates[i][bestState];
+		}
+		return Steinberg::kResultOk;
+	}
+
+	/** Get candidate arrangement for an index returned by negotiate(). */
+	Steinberg::Vst::SpeakerArrangement getCandidate (Steinberg::int32 index) const
+	{
+		return index >= 0 && index < numCandidates ? candidates[index] : 0;
+	}
+
+protected:
+	static const Steinberg::int64 kUnreachable = 0x7fffffffffffffffLL;
+
+	Steinberg::int32 numCandidates;
+	Steinberg::Vst::SpeakerArrangement candidates[kMaxCandidates];
+	Steinberg::int64 conversionCosts[kMaxCandidates + 1][kMaxCandidates]; ///< last row used for source arrangement
+	Steinberg::int8 previousStates[kMaxInserts][kMaxCandidates + 1];
+};
+
 } // namespace Presonus
 
 #include "pluginterfaces/base/falignpop.h"
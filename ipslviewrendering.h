@@ -4,7 +4,7 @@
 // Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
 //
 // Filename    : ipslviewrendering.h
-// Created by  : PreSonus Software Ltd., 09/2023
+// Created by  : PreSonus Software Ltd., 09/2023, last updated 10/2026
 // Description : Plug-in View Rendering Interfaces
 //
 //************************************************************************************************
@@ -20,10 +20,11 @@
 #define _ipslviewrendering_h
 
 #include "pluginterfaces/base/funknown.h"
-#include "pluginterfaces/base/falignpush.h"
+#include "pluginterfaces/gui/iplugview.h"
+
+#include <cstring>
 
-namespace Steinberg {
-struct ViewRect; }
+#include "pluginterfaces/base/falignpush.h"
 
 namespace Presonus {
 
@@ -34,12 +35,123 @@ const Steinberg::FIDString kPlatformTypePlugViewRendering = "IPlugViewRendering"
 /** Identifer for RGBA pixel format. */
 constexpr Steinberg::int32 kPixelFormatRGBA = 'RGBA';
 
+/** Identifer for BGRA pixel format. */
+constexpr Steinberg::int32 kPixelFormatBGRA = 'BGRA';
+
+/** Identifer for RGBA pixel format with color components premultiplied by alpha. */
+constexpr Steinberg::int32 kPixelFormatRGBAPremultiplied = 'RGBP';
+
+/** Identifer for BGRA pixel format with color components premultiplied by alpha. */
+constexpr Steinberg::int32 kPixelFormatBGRAPremultiplied = 'BGRP';
+
+/** Identifer for 8 bit alpha-only pixel format. */
+constexpr Steinberg::int32 kPixelFormatA8 = 'A8  ';
+
 /** Coordinate unit physical pixels. */
 constexpr Steinberg::int32 kCoordinateUnitPhysicalPixels = 0;
 
 /** Coordinate unit scalable points, i.e. pixels = points x scaling factor */
 constexpr Steinberg::int32 kCoordinateUnitScalablePoints = 1;
 
+//************************************************************************************************
+// ScalablePointMapping
+/**	Exact conversion between scalable points and physical pixels, used with kCoordinateUnitScalablePoints.
+
+	The scale factor is represented as a ratio of integers (e.g. 5/4 for 125%) and all conversions use
+	integer arithmetic, so host and plug-in compute identical pixel coordinates. Converting rectangle
+	edges with toPixels() maps adjacent rectangles to adjacent pixel rectangles without gaps or overlap,
+	e.g. for tiles. getCoveringPixelRect() rounds outwards and returns all pixels touched by a rectangle
+	in points, e.g. for dirty rectangles, without additional padding.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct ScalablePointMapping
+{
+	Steinberg::int32 numerator;
+	Steinberg::int32 denominator;
+
+	ScalablePointMapping (Steinberg::int32 numerator = 1, Steinberg::int32 denominator = 1)
+	: numerator (numerator),
+	  denominator (denominator)
+	{}
+
+	/** Create mapping from scale factor, rounded to a multiple of 1/96 (i.e. one DPI step on Windows). */
+	static ScalablePointMapping fromScaleFactor (float factor)
+	{
+		Steinberg::int32 n = Steinberg::int32 (factor * 96.f + .5f);
+		Steinberg::int32 d = 96;
+		if(n < 1)
+			n = 1;
+		Steinberg::int32 a = n, b = d;
+		while(b != 0)
+		{
+			Steinberg::int32 t = a % b;
+			a = b;
+			b = t;
+		}
+		return ScalablePointMapping (n / a, d / a);
+	}
+
+	/** Convert coordinate from points to pixels, rounding down. */
+	Steinberg::int32 toPixels (Steinberg::int32 points) const
+	{
+		return floorDivide (Steinberg::int64 (points) * numerator, denominator);
+	}
+
+	/** Convert coordinate from pixels to points, rounding down. */
+	Steinberg::int32 toPoints (Steinberg::int32 pixels) const
+	{
+		return floorDivide (Steinberg::int64 (pixels) * denominator, numerator);
+	}
+
+	/** Check if a distance in points maps to a whole number of pixels. */
+	bool isWholePixels (Steinberg::int32 points) const
+	{
+		return (Steinberg::int64 (points) * numerator) % denominator == 0;
+	}
+
+	/** Convert rectangle from points to pixels, edge by edge. */
+	Steinberg::ViewRect toPixels (const Steinberg::ViewRect& r) const
+	{
+		return Steinberg::ViewRect (toPixels (r.left), toPixels (r.top), toPixels (r.right), toPixels (r.bottom));
+	}
+
+	/** Get all pixels touched by given rectangle in points. */
+	Steinberg::ViewRect getCoveringPixelRect (const Steinberg::ViewRect& r) const
+	{
+		return Steinberg::ViewRect (toPixels (r.left), toPixels (r.top), ceilDivide (Steinberg::int64 (r.right) * numerator, denominator),
+									ceilDivide (Steinberg::int64 (r.bottom) * numerator, denominator));
+	}
+
+	/** Get all points touched by given rectangle in pixels. */
+	Steinberg::ViewRect getCoveringPointRect (const Steinberg::ViewRect& r) const
+	{
+		return Steinberg::ViewRect (toPoints (r.left), toPoints (r.top), ceilDivide (Steinberg::int64 (r.right) * denominator, numerator),
+									ceilDivide (Steinberg::int64 (r.bottom) * denominator, numerator));
+	}
+
+	/** Convert position of input event from pixels to points. */
+	template<class Event> void toPoints (Event& event) const
+	{
+		event.x = toPoints (event.x);
+		event.y = toPoints (event.y);
+	}
+
+	static Steinberg::int32 floorDivide (Steinberg::int64 a, Steinberg::int64 b)
+	{
+		Steinberg::int64 q = a / b;
+		if((a % b != 0) && ((a < 0) != (b < 0)))
+			q--;
+		return Steinberg::int32 (q);
+	}
+
+	static Steinberg::int32 ceilDivide (Steinberg::int64 a, Steinberg::int64 b)
+	{
+		return -floorDivide (-a, b);
+	}
+};
+
 //************************************************************************************************
 // BitmapPixelBuffer
 //************************************************************************************************
@@ -48,7 +160,7 @@ struct BitmapPixelBuffer
 {
 	Steinberg::int32 width = 0;					///< bitmap width
 	Steinberg::int32 height = 0;				///< bitmap height
-	Steinberg::int32 format = kPixelFormatRGBA;	///< pixel format
+	Steinberg::int32 format = kPixelFormatRGBA;	///< pixel format (kPixelFormatRGBA, kPixelFormatBGRA, etc.)
 	Steinberg::int32 rowBytes = 0;				///< offset between scanlines in bytes (can be negative if image is bottom-up!)
 	void* scan0 = nullptr;						///< address of first scanline
 };
@@ -95,6 +207,271 @@ struct BitmapLockScope
 	Steinberg::tresult result;
 };
 
+//************************************************************************************************
+// BitmapPixelScroller
+/** Helper to move pixels inside a locked bitmap, e.g. for IPlugRenderingFrameScrolling.
+	Rows are moved with memmove() in an order that works for overlapping source and destination
+	and for bottom-up bitmaps with negative rowBytes. Coordinates are in bitmap pixels.
+	Pixels of the exposed area are left unchanged. */
+//************************************************************************************************
+
+struct BitmapPixelScroller
+{
+	/** Get number of bytes per pixel for given format. */
+	static Steinberg::int32 getBytesPerPixel (Steinberg::int32 format)
+	{
+		return format == kPixelFormatA8 ? 1 : 4;
+	}
+
+	/** Move content of rect by dx, dy, clipped to rect and bitmap bounds. */
+	static void scroll (const BitmapPixelBuffer& buffer, const Steinberg::ViewRect& rect, Steinberg::int32 dx, Steinberg::int32 dy)
+	{
+		Steinberg::int32 left = rect.left < 0 ? 0 : rect.left;
+		Steinberg::int32 top = rect.top < 0 ? 0 : rect.top;
+		Steinberg::int32 right = rect.right > buffer.width ? buffer.width : rect.right;
+		Steinberg::int32 bottom = rect.bottom > buffer.height ? buffer.height : rect.bottom;
+
+		Steinberg::int32 width = right - left - (dx < 0 ? -dx : dx);
+		Steinberg::int32 height = bottom - top - (dy < 0 ? -dy : dy);
+		if(width <= 0 || height <= 0 || buffer.scan0 == nullptr)
+			return;
+
+		Steinberg::int32 bytesPerPixel = getBytesPerPixel (buffer.format);
+		Steinberg::int32 srcX = dx < 0 ? left - dx : left;
+		Steinberg::int32 dstX = dx > 0 ? left + dx : left;
+		Steinberg::int32 srcY = dy < 0 ? top - dy : top;
+		Steinberg::int32 dstY = dy > 0 ? top + dy : top;
+
+		Steinberg::uint8* base = static_cast<Steinberg::uint8*> (buffer.scan0);
+		size_t length = size_t (width) * bytesPerPixel;
+		for(Steinberg::int32 i = 0; i < height; i++)
+		{
+			Steinberg::int32 y = dy > 0 ? height - 1 - i : i; // move rows bottom to top when scrolling down
+			Steinberg::uint8* dst = base + Steinberg::int64 (dstY + y) * buffer.rowBytes + Steinberg::int64 (dstX) * bytesPerPixel;
+			const Steinberg::uint8* src = base + Steinberg::int64 (srcY + y) * buffer.rowBytes + Steinberg::int64 (srcX) * bytesPerPixel;
+			std::memmove (dst, src, length);
+		}
+	}
+};
+
+//************************************************************************************************
+// BitmapPixelConverter
+/** Helper to convert pixels between kPixelFormatRGBA, kPixelFormatBGRA and their premultiplied variants,
+	e.g. when the format of a render target differs from the one used by the plug-in's graphics engine.
+	Red and blue components are swapped and color components are premultiplied or unpremultiplied
+	as needed. Bottom-up bitmaps with negative rowBytes are supported.
+
+	This is a portable reference implementation for hosts without a conversion in their graphics code,
+	not the fast path: negotiating a format via IPlugViewRendering::isRenderingTypeSupported() avoids
+	conversions altogether, and hosts converting large views per frame should use the SIMD kernels of
+	their graphics library. The conversion mode is resolved once per call and each mode has its own row
+	loop. The swap-only loop works on whole 32 bit pixels and is auto-vectorized by common compilers. */
+//************************************************************************************************
+
+struct BitmapPixelConverter
+{
+	bool swapRedBlue;
+	bool premultiply;
+	bool unpremultiply;
+	bool copyOnly;
+
+	BitmapPixelConverter (): swapRedBlue (false), premultiply (false), unpremultiply (false), copyOnly (false) {}
+
+	/** Prepare conversion between given formats. \return kResultOk if the conversion is supported */
+	Steinberg::tresult init (Steinberg::int32 from, Steinberg::int32 to)
+	{
+		swapRedBlue = premultiply = unpremultiply = copyOnly = false;
+		if(from == to)
+		{
+			copyOnly = true;
+			return Steinberg::kResultOk;
+		}
+
+		if(isColorFormat (from) == false || isColorFormat (to) == false)
+			return Steinberg::kResultFalse;
+
+		swapRedBlue = isBGR (from) != isBGR (to);
+		premultiply = isPremultiplied (to) && !isPremultiplied (from);
+		unpremultiply = isPremultiplied (from) && !isPremultiplied (to);
+		return Steinberg::kResultOk;
+	}
+
+	/** Check if a conversion has been prepared. */
+	bool isValid () const { return copyOnly || swapRedBlue || premultiply || unpremultiply; }
+
+	/**	Convert pixels of source to target, clipped to the smaller of both bitmaps. Source and target can be
+		the same bitmap for in-place conversion, otherwise they must not overlap. */
+	void process (const BitmapPixelBuffer& source, const BitmapPixelBuffer& target) const
+	{
+		Steinberg::int32 width = source.width < target.width ? source.width : target.width;
+		Steinberg::int32 height = source.height < target.height ? source.height : target.height;
+		if(width <= 0 || height <= 0 || source.scan0 == nullptr || target.scan0 == nullptr || isValid () == false)
+			return;
+
+		const Steinberg::uint8* srcRow = static_cast<const Steinberg::uint8*> (source.scan0);
+		Steinberg::uint8* dstRow = static_cast<Steinberg::uint8*> (target.scan0);
+
+		if(copyOnly)
+		{
+			size_t length = size_t (width) * BitmapPixelScroller::getBytesPerPixel (source.format);
+			for(Steinberg::int32 y = 0; y < height; y++, srcRow += source.rowBytes, dstRow += target.rowBytes)
+				if(dstRow != srcRow)
+					std::memcpy (dstRow, srcRow, length);
+		}
+		else if(premultiply)
+		{
+			for(Steinberg::int32 y = 0; y < height; y++, srcRow += source.rowBytes, dstRow += target.rowBytes)
+				if(swapRedBlue)
+					premultiplyRow<true> (srcRow, dstRow, width);
+				else
+					premultiplyRow<false> (srcRow, dstRow, width);
+		}
+		else if(unpremultiply)
+		{
+			for(Steinberg::int32 y = 0; y < height; y++, srcRow += source.rowBytes, dstRow += target.rowBytes)
+				if(swapRedBlue)
+					unpremultiplyRow<true> (srcRow, dstRow, width);
+				else
+					unpremultiplyRow<false> (srcRow, dstRow, width);
+		}
+		else
+		{
+			for(Steinberg::int32 y = 0; y < height; y++, srcRow += source.rowBytes, dstRow += target.rowBytes)
+				swapRow (srcRow, dstRow, width);
+		}
+	}
+
+	/** Swap red and blue components of a row of 32 bit pixels. */
+	static void swapRow (const Steinberg::uint8* src, Steinberg::uint8* dst, Steinberg::int32 width)
+	{
+		// bytes 1 and 3 (green and alpha) stay in place, bytes 0 and 2 are exchanged by rotating by 16 bits
+		static const Steinberg::uint8 keepBytes[4] = {0, 0xff, 0, 0xff};
+		Steinberg::uint32 keep;
+		std::memcpy (&keep, keepBytes, 4);
+
+		for(Steinberg::int32 x = 0; x < width; x++)
+		{
+			Steinberg::uint32 p;
+			std::memcpy (&p, src + x * 4, 4);
+			p = (p & keep) | (((p << 16) | (p >> 16)) & ~keep);
+			std::memcpy (dst + x * 4, &p, 4);
+		}
+	}
+
+	/** Premultiply color components of a row, optionally swapping red and blue. */
+	template<bool swap>
+	static void premultiplyRow (const Steinberg::uint8* src, Steinberg::uint8* dst, Steinberg::int32 width)
+	{
+		for(Steinberg::int32 x = 0; x < width; x++, src += 4, dst += 4)
+		{
+			Steinberg::uint32 c0 = src[swap ? 2 : 0], c1 = src[1], c2 = src[swap ? 0 : 2], a = src[3];
+			dst[0] = Steinberg::uint8 ((c0 * a + 127) / 255);
+			dst[1] = Steinberg::uint8 ((c1 * a + 127) / 255);
+			dst[2] = Steinberg::uint8 ((c2 * a + 127) / 255);
+			dst[3] = Steinberg::uint8 (a);
+		}
+	}
+
+	/** Unpremultiply color components of a row, optionally swapping red and blue. */
+	template<bool swap>
+	static void unpremultiplyRow (const Steinberg::uint8* src, Steinberg::uint8* dst, Steinberg::int32 width)
+	{
+		for(Steinberg::int32 x = 0; x < width; x++, src += 4, dst += 4)
+		{
+			Steinberg::uint32 c0 = src[swap ? 2 : 0], c1 = src[1], c2 = src[swap ? 0 : 2], a = src[3];
+			dst[0] = Steinberg::uint8 (unpremultiplyComponent (c0, a));
+			dst[1] = Steinberg::uint8 (unpremultiplyComponent (c1, a));
+			dst[2] = Steinberg::uint8 (unpremultiplyComponent (c2, a));
+			dst[3] = Steinberg::uint8 (a);
+		}
+	}
+
+	static bool isColorFormat (Steinberg::int32 format)
+	{
+		return format == kPixelFormatRGBA || format == kPixelFormatBGRA ||
+			   format == kPixelFormatRGBAPremultiplied || format == kPixelFormatBGRAPremultiplied;
+	}
+
+	static bool isBGR (Steinberg::int32 format)
+	{
+		return format == kPixelFormatBGRA || format == kPixelFormatBGRAPremultiplied;
+	}
+
+	static bool isPremultiplied (Steinberg::int32 format)
+	{
+		return format == kPixelFormatRGBAPremultiplied || format == kPixelFormatBGRAPremultiplied;
+	}
+
+	static Steinberg::uint32 unpremultiplyComponent (Steinberg::uint32 c, Steinberg::uint32 a)
+	{
+		if(a == 0)
+			return 0;
+		Steinberg::uint32 result = (c * 255 + a / 2) / a;
+		return result > 255 ? 255 : result;
+	}
+};
+
+//************************************************************************************************
+// SharedBitmapDescription
+//************************************************************************************************
+
+struct SharedBitmapDescription
+{
+	Steinberg::int64 handle = -1;				///< shared memory handle (file descriptor on Linux and macOS, HANDLE on Windows)
+	Steinberg::int64 mappingSize = 0;			///< size of shared memory in bytes
+	Steinberg::int32 bufferId = 0;				///< unique identifier of shared memory, the mapping can be reused as long as it doesn't change
+	Steinberg::int32 width = 0;					///< bitmap width
+	Steinberg::int32 height = 0;				///< bitmap height
+	Steinberg::int32 format = kPixelFormatRGBA;	///< pixel format
+	Steinberg::int32 rowBytes = 0;				///< offset between scanlines in bytes (positive, multiple of kSharedBitmapRowAlignment)
+	Steinberg::int64 pixelOffset = 0;			///< offset of first scanline from start of shared memory in bytes
+	Steinberg::int64 sequenceOffset = 0;		///< offset of 64 bit sequence counter from start of shared memory in bytes (8-byte aligned)
+};
+
+/** Alignment of rows in shared bitmaps in bytes. */
+constexpr Steinberg::int32 kSharedBitmapRowAlignment = 64;
+
+//************************************************************************************************
+// ISharedBitmapAccessor
+/** Rendering target backed by shared memory, for hosts running plug-ins in a separate process.
+
+	The bitmap lives in shared memory (e.g. created via memfd_create() on Linux) which is mapped
+	by both the host compositor and the sandboxed plug-in process, so that rendered pixels don't
+	have to be copied between processes. The handle is valid in the process of the plug-in and
+	remains owned by the host, i.e. the plug-in has to duplicate it if it needs to keep it open.
+	The plug-in maps the memory once and keeps the mapping as long as bufferId doesn't change.
+
+	The sequence counter in shared memory works as a sequence lock, so that the compositor can detect
+	frames that are modified while it reads them, without additional inter-process signalling:
+	- Before writing pixels, the plug-in increments the counter to an odd value, followed by a release
+	  fence (std::atomic_thread_fence (std::memory_order_release)). When the frame is complete, it
+	  increments the counter to an even value with release semantics (e.g. std::atomic_ref<uint64>::
+	  fetch_add (1, std::memory_order_release)).
+	- The compositor reads the counter with acquire semantics and ignores odd or unchanged values.
+	  After copying the pixels (e.g. uploading them to a texture), it issues an acquire fence and reads
+	  the counter again. If the value has changed, the copy may be torn and must be discarded. The
+	  compositor keeps presenting its previous copy and retries with the next display refresh.
+
+	As the plug-in renders into the same buffer again, the compositor must not present directly from
+	shared memory. Hosts which want to avoid discarded copies should not request the next render() before
+	the compositor has finished copying, or use a ring of shared targets via IPlugViewAsyncRendering.
+
+	Hosts check support via IPlugViewRendering::isRenderingTypeSupported() with
+	ISharedBitmapAccessor::iid and the pixel format of the shared memory.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct ISharedBitmapAccessor: Steinberg::FUnknown
+{
+	/** Get description of shared memory bitmap. */
+	virtual Steinberg::tresult PLUGIN_API getSharedBitmap (SharedBitmapDescription* description) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (ISharedBitmapAccessor, 0x4d70c3fe, 0x3a534f77, 0xa79083c8, 0xe77603c3)
+
 //************************************************************************************************
 // IPlugViewCoordinateUnitSupport
 /** Interface to query coordinate unit, to be implemented by the VST3 IPlugView class.
@@ -105,7 +482,8 @@ struct IPlugViewCoordinateUnitSupport: Steinberg::FUnknown
 {
 	/**	Check which coordinate unit is used by the plug-in view, i.e. kCoordinateUnitPhysicalPixels
 		or kCoordinateUnitScalablePoints. This decision affects all coordinates for rendering
-		(IPlugViewRendering and IPlugRenderingFrame) and mouse input (IPlugViewMouseInput). */
+		(IPlugViewRendering and IPlugRenderingFrame) and mouse input (IPlugViewMouseInput).
+		Use ScalablePointMapping to convert between points and pixels. */
 	virtual Steinberg::int32 PLUGIN_API getCoordinateUnit () = 0;
 
 	static const Steinberg::FUID iid;
@@ -122,11 +500,14 @@ DECLARE_CLASS_IID (IPlugViewCoordinateUnitSupport, 0xeae3ebb, 0xb301468a, 0xa127
 struct IPlugViewRendering: Steinberg::FUnknown
 {
 	/** Check if given rendering type and format is supported.
-		For bitmaps, this is IBitmapAccessor::iid and kPixelFormatRGBA. */
+		For bitmaps, this is IBitmapAccessor::iid and kPixelFormatRGBA. Hosts can check other
+		formats like kPixelFormatBGRAPremultiplied in order of preference, to avoid converting
+		rendered pixels to the format used by their compositor. kPixelFormatRGBA has to be supported
+		by all plug-ins implementing this interface. */
 	virtual Steinberg::tresult PLUGIN_API isRenderingTypeSupported (Steinberg::TUID type, Steinberg::int32 format) = 0;
 
 	/**	Render plug-in view to given target.
-		Rendering target can be a bitmap (IBitmapAccessor). */
+		Rendering target can be a bitmap (IBitmapAccessor) or a shared memory bitmap (ISharedBitmapAccessor). */
 	virtual Steinberg::tresult PLUGIN_API render (Steinberg::FUnknown* target, Steinberg::ViewRect* updateRect) = 0;
 
 	static const Steinberg::FUID iid;
@@ -134,6 +515,29 @@ struct IPlugViewRendering: Steinberg::FUnknown
 
 DECLARE_CLASS_IID (IPlugViewRendering, 0x215519ce, 0xb4de449f, 0x9572b7f2, 0x4a004a8f)
 
+//************************************************************************************************
+// IPlugViewRendering2
+/** Extension to IPlugViewRendering for rendering multiple update rectangles at once, to be
+	implemented by the VST3 IPlugView class.
+
+	If separate areas of the view need to be updated, e.g. two meters in opposite corners, the host
+	passes the exact list of rectangles instead of their bounding box. The target is locked only
+	once and the plug-in paints all rectangles in one pass.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewRendering2: IPlugViewRendering
+{
+	/**	Render given region of plug-in view to target. The region is described by numRects
+		non-overlapping rectangles. Pixels outside of the region must not be modified. */
+	virtual Steinberg::tresult PLUGIN_API renderRegion (Steinberg::FUnknown* target, const Steinberg::ViewRect* rects, Steinberg::int32 numRects) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewRendering2, 0x6ac2e6df, 0x45174bb4, 0x94fe0072, 0xdeaa5607)
+
 //************************************************************************************************
 // IPlugRenderingFrame
 /** Callback interface when view rendering is used. Implemented by host as extension to IPlugFrame.
@@ -150,6 +554,593 @@ struct IPlugRenderingFrame: Steinberg::FUnknown
 
 DECLARE_CLASS_IID (IPlugRenderingFrame, 0x68956019, 0x4b964921, 0x9c249f6a, 0xbcff47c6)
 
+//************************************************************************************************
+// IPlugRenderingFrame2
+/** Extension to IPlugRenderingFrame for host-driven frame pacing. Implemented by host as extension to IPlugFrame.
+
+	The host accumulates rectangles passed to invalidateViewRect() (see PlugViewDirtyRegion) and
+	renders at most once per display refresh, using IPlugViewRendering2::renderRegion() if available
+	(see PlugRenderingFrame in pslrenderingframe.h for a reference implementation).
+	Plug-ins can therefore invalidate at any rate without causing additional render calls.
+	Instead of running their own animation timers, plug-ins can request frame ticks which are
+	delivered to IPlugViewFrameTick once per display refresh, right before rendering.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugRenderingFrame2: IPlugRenderingFrame
+{
+	/** Enable or disable calls to IPlugViewFrameTick::onFrameTick(). Ticks are disabled initially. */
+	virtual Steinberg::tresult PLUGIN_API enableFrameTicks (Steinberg::TBool state) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugRenderingFrame2, 0x2a4e4990, 0x46dc4629, 0x8e8b7dd7, 0xcfd15dfa)
+
+//************************************************************************************************
+// IPlugRenderingFrameScrolling
+/** Support for scrolling rendered content without repainting it. Implemented by host as extension to IPlugFrame.
+
+	Views with continuously scrolling content, like waveforms or spectrograms, can ask the host to
+	move pixels of the last rendered frame instead of invalidating the whole area. The host moves the
+	pixels in its retained copy of the view (see BitmapPixelScroller) before the next frame is rendered
+	and invalidates the exposed area, so the plug-in only renders the new strip. Pending invalidated
+	rectangles inside the scrolled area are moved as well, scroll requests and invalidations are
+	applied in the order of the calls.
+
+	Like all view coordinates, rect, dx and dy are given in the unit negotiated via
+	IPlugViewCoordinateUnitSupport. With kCoordinateUnitScalablePoints, the host converts rect to pixels
+	edge by edge via ScalablePointMapping::toPixels(). Pixels can only be moved by whole pixel distances,
+	so the host returns kResultFalse if dx or dy in points doesn't map to a whole number of pixels
+	(see ScalablePointMapping::isWholePixels()), e.g. scrolling by 1 point at 125%. Plug-ins which want
+	to scroll efficiently at any scale factor should choose scroll distances that are multiples of
+	ScalablePointMapping::denominator points.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugRenderingFrameScrolling: Steinberg::FUnknown
+{
+	/**	Move content inside of rect by dx, dy. Content moved outside of rect is discarded.
+		\return kResultOk if the host performs the scroll, kResultFalse if it doesn't (e.g. the distance isn't
+		whole pixels), the plug-in has to invalidate rect in this case */
+	virtual Steinberg::tresult PLUGIN_API scrollViewRect (const Steinberg::ViewRect* rect, Steinberg::int32 dx, Steinberg::int32 dy) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugRenderingFrameScrolling, 0x63fe64db, 0xcc3b419c, 0xbb95c8c2, 0x7e84dc2e)
+
+//************************************************************************************************
+// IPlugViewFrameTick
+/** Frame tick callback, to be implemented by the VST3 IPlugView class.
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewFrameTick: Steinberg::FUnknown
+{
+	/**	Called by the host in the UI thread once per display refresh while frame ticks are enabled
+		(see IPlugRenderingFrame2). The plug-in can advance animations and call invalidateViewRect()
+		from here, the invalidated region is rendered in the same frame. frameTime is the expected
+		presentation time of the frame and frameInterval the time between two frames, both in nanoseconds
+		(based on a monotonic system clock). */
+	virtual void PLUGIN_API onFrameTick (Steinberg::int64 frameTime, Steinberg::int64 frameInterval) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewFrameTick, 0xc3f8a7b6, 0x2b7a49a0, 0x83b93a64, 0xd1c354e1)
+
+//************************************************************************************************
+// PlugViewRenderHints
+/** Per-frame hints for rendering, used with IPlugViewRenderBudget. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewRenderHints
+{
+	enum Quality
+	{
+		kQualityLow = 0,	///< reduce work as much as possible, e.g. skip anti-aliasing and decimate data
+		kQualityMedium,		///< reduce expensive details
+		kQualityHigh		///< full quality
+	};
+
+	Steinberg::int64 frameTime = 0;			///< expected presentation time in nanoseconds (see IPlugViewFrameTick)
+	Steinberg::int64 timeBudget = 0;		///< time available for rendering this view in nanoseconds, zero if not limited
+	Steinberg::int32 quality = kQualityHigh;///< suggested quality level
+	Steinberg::int32 viewCount = 1;			///< number of plug-in views rendered in this frame
+};
+
+//************************************************************************************************
+// PlugViewRenderCost
+/** Cost of rendering a frame, used with IPlugViewRenderBudget. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewRenderCost
+{
+	Steinberg::int64 renderTime = 0;		///< time spent for rendering in nanoseconds, including work on other threads
+	Steinberg::int64 fullQualityTime = 0;	///< estimated time at kQualityHigh in nanoseconds, zero if unknown
+	Steinberg::int32 quality = PlugViewRenderHints::kQualityHigh;	///< quality level used for rendering
+};
+
+//************************************************************************************************
+// IPlugViewRenderBudget
+/** Support for render time budgets, to be implemented by the VST3 IPlugView class.
+
+	The host knows its frame deadline and how many views it has to render. Before rendering a view,
+	it passes the remaining time budget and a suggested quality level. After rendering, it queries the
+	actual cost, so that it can distribute the budget between views and restore the quality level when
+	there is enough time. Heavy views can degrade gracefully instead of stalling the UI thread.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewRenderBudget: Steinberg::FUnknown
+{
+	/** Set hints for the following render calls of the current frame. Called in the UI thread. */
+	virtual Steinberg::tresult PLUGIN_API setRenderHints (const PlugViewRenderHints& hints) = 0;
+
+	/** Get cost of rendering in the current frame, called after the last render call of the frame. */
+	virtual Steinberg::tresult PLUGIN_API getRenderCost (PlugViewRenderCost& cost) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewRenderBudget, 0x0c0180e4, 0xbe674788, 0xbe5763cc, 0x358bb749)
+
+//************************************************************************************************
+// PlugViewSchedulingInfo
+/** Scheduling requirements of a rendered view, used with IPlugViewRenderScheduling. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewSchedulingInfo
+{
+	enum Flags
+	{
+		kRenderOnWorkerThread = 1<<0	///< render calls may be made from a host worker thread instead of the UI thread
+	};
+
+	Steinberg::int32 flags = 0;				///< see Flags
+	float preferredFrameRate = 60.f;		///< frame rate needed for smooth animation in frames per second, zero for static content (rendered whenever invalidated, at most once per frame)
+	float minFrameRate = 0.f;				///< lowest acceptable frame rate while visible but throttled in frames per second, zero to leave it to the host
+};
+
+//************************************************************************************************
+// IPlugViewRenderScheduling
+/** Scheduling information for hosts driving many rendered views, to be implemented by the VST3 IPlugView class.
+
+	Instead of rendering each view on its own timer, the host can drive all views from a single frame
+	clock (see IPlugViewFrameTick) and render them on a bounded pool of worker threads. Views are
+	prioritized by focus and visibility (see IPlugViewVisibility), views in the background are throttled
+	to a frame rate chosen by the host, but not below minFrameRate (see PlugViewFrameScheduler in
+	pslframescheduler.h). Skipped and late frames are reported via IPlugRenderingStatisticsFrame.
+
+	If kRenderOnWorkerThread is set, the host may call render methods of this view from any of its
+	worker threads, but never concurrently for the same view and never concurrently with other calls
+	to the view made in the UI thread. Otherwise all render calls are made in the UI thread.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewRenderScheduling: Steinberg::FUnknown
+{
+	/** Get scheduling requirements, called after the view has been attached. */
+	virtual Steinberg::tresult PLUGIN_API getSchedulingInfo (PlugViewSchedulingInfo& info) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewRenderScheduling, 0x437ff5a6, 0x21bd48d6, 0x8f63b37d, 0xc45fbddd)
+
+//************************************************************************************************
+// IPlugViewAsyncRendering
+/** Support for asynchronous rendering on a plug-in thread, to be implemented by the VST3 IPlugView class.
+
+	The host provides a small ring of render targets, usually three. The plug-in renders into a target
+	it owns on its own thread and passes it to the host via IPlugAsyncRenderingFrame::publishFrame().
+	The host presents the most recently published frame with the next display refresh and returns
+	targets that are no longer needed via releaseRenderTarget(). Neither side ever waits for the other:
+	with three targets, one is presented by the host, one is rendered by the plug-in and one is pending
+	or free.
+
+	All targets belong to the plug-in initially. Since each target holds a different frame, the plug-in
+	has to track which areas are outdated per target (see PlugViewDirtyRegion) when reusing a target.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewAsyncRendering: Steinberg::FUnknown
+{
+	/**	Set render targets, called in the UI thread. All targets have the same size and format, the
+		index into this array identifies a target in the other methods. Passing no targets stops
+		asynchronous rendering, the plug-in must not access previous targets after returning from this call.
+		\return kResultOk if asynchronous rendering is supported for given targets */
+	virtual Steinberg::tresult PLUGIN_API setRenderTargets (Steinberg::FUnknown** targets, Steinberg::int32 numTargets) = 0;
+
+	/**	Return ownership of a previously published target to the plug-in. Called in the UI thread after a
+		newer frame has been presented, or in the thread calling IPlugAsyncRenderingFrame::publishFrame()
+		from inside that call if a pending frame is replaced. The plug-in must therefore handle this call
+		from any thread without blocking, e.g. by marking the target as free in an atomic bit mask. */
+	virtual void PLUGIN_API releaseRenderTarget (Steinberg::int32 targetIndex) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewAsyncRendering, 0x96a71d0a, 0xe48d475e, 0x8ff7d8d3, 0x6dd8a076)
+
+//************************************************************************************************
+// IPlugAsyncRenderingFrame
+/** Callback interface for asynchronous rendering. Implemented by host as extension to IPlugFrame.
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugAsyncRenderingFrame: Steinberg::FUnknown
+{
+	/**	Publish a completed frame, can be called from any thread and doesn't block. Ownership of the
+		target passes to the host. The rectangles describe which areas have changed compared to the
+		previously published frame. If a published frame is replaced by a newer one before it has been
+		presented, the host releases it immediately, i.e. calls IPlugViewAsyncRendering::releaseRenderTarget()
+		before returning, and combines the changed areas of both frames. */
+	virtual Steinberg::tresult PLUGIN_API publishFrame (Steinberg::int32 targetIndex, const Steinberg::ViewRect* dirtyRects, Steinberg::int32 numRects) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugAsyncRenderingFrame, 0x0ca0ded2, 0xcf5e4d27, 0x9398b9b9, 0xfe7ba501)
+
+//************************************************************************************************
+// IPlugViewTiledRendering
+/** Support for rendering a view in parallel tiles, to be implemented by the VST3 IPlugView class.
+
+	For large views the host can split the update rectangle into tiles (see PlugViewTileGrid) and
+	render them on multiple threads at the same time. By implementing this interface the plug-in
+	declares that renderTile() is reentrant for disjoint tiles of the same target.
+
+	Call sequence for one frame:
+	- beginTiledRendering() in the UI thread, the plug-in prepares all state shared by the tiles
+	  (layout, animation values, etc.). If the result is not kResultOk, the host uses render() instead.
+	- renderTile() for each tile, called concurrently from worker threads. The target stays locked
+	  by the host during the whole frame, so IBitmapAccessor::lockPixelBuffer() is cheap, thread-safe
+	  and returns the same buffer for all tiles.
+	- endTiledRendering() in the UI thread when all tiles are done.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewTiledRendering: Steinberg::FUnknown
+{
+	/** Prepare rendering of given area in tiles, called in the UI thread. */
+	virtual Steinberg::tresult PLUGIN_API beginTiledRendering (Steinberg::FUnknown* target, const Steinberg::ViewRect* updateRect) = 0;
+
+	/** Render a single tile, called concurrently from multiple threads. Pixels outside of the tile must not be modified. */
+	virtual Steinberg::tresult PLUGIN_API renderTile (Steinberg::FUnknown* target, const Steinberg::ViewRect* tileRect) = 0;
+
+	/** Finish rendering of all tiles, called in the UI thread. */
+	virtual Steinberg::tresult PLUGIN_API endTiledRendering (Steinberg::FUnknown* target) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewTiledRendering, 0x2ea2080f, 0xbcda4c6e, 0x9156cd78, 0xfa867aa3)
+
+//************************************************************************************************
+// PlugViewLayerInfo
+/** Description of a layer, used with IPlugViewLayerRendering. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewLayerInfo
+{
+	enum Flags
+	{
+		kLayerOpaque = 1<<0,	///< all pixels of the layer are opaque, layers below don't need to be composited
+		kLayerStatic = 1<<1		///< content changes rarely, e.g. only if the size or scale factor changes
+	};
+
+	Steinberg::int32 layerId = 0;	///< identifier of layer, unique per view
+	Steinberg::int32 flags = 0;		///< see Flags
+	Steinberg::ViewRect rect;		///< position and size of layer in view coordinates
+};
+
+//************************************************************************************************
+// IPlugViewLayerRendering
+/** Support for rendering a view in layers, to be implemented by the VST3 IPlugView class.
+
+	Plug-in editors usually consist of a large static background and a few small animated elements.
+	With layers, the host keeps a cached copy of each layer and composites them in index order,
+	using alpha blending for non-opaque layers. The static base layer is rendered once per size or
+	scale change, per frame only the invalidated areas of the small overlay layers are rendered
+	(see IPlugRenderingLayerFrame).
+
+	The first layer is the base layer and covers the whole view. The host calls getLayerCount() and
+	getLayerInfo() after the view is attached and when the plug-in signals a change. If getLayerCount()
+	returns zero, the host uses IPlugViewRendering instead.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewLayerRendering: Steinberg::FUnknown
+{
+	/** Get number of layers. */
+	virtual Steinberg::int32 PLUGIN_API getLayerCount () = 0;
+
+	/** Get description of layer at given index. */
+	virtual Steinberg::tresult PLUGIN_API getLayerInfo (Steinberg::int32 index, PlugViewLayerInfo& info) = 0;
+
+	/**	Render layer to given target. The target has the size of the layer, i.e. the top left corner of the
+		layer is at the origin of the target. updateRect is in view coordinates. */
+	virtual Steinberg::tresult PLUGIN_API renderLayer (Steinberg::int32 layerId, Steinberg::FUnknown* target, const Steinberg::ViewRect* updateRect) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewLayerRendering, 0x93b19f36, 0xb86e46f3, 0x85047d9f, 0x25a361bc)
+
+//************************************************************************************************
+// IPlugRenderingLayerFrame
+/** Callback interface for layer rendering. Implemented by host as extension to IPlugFrame.
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugRenderingLayerFrame: Steinberg::FUnknown
+{
+	/** Invalidate given rectangle of a layer in view coordinates. Other layers are not rendered again. */
+	virtual Steinberg::tresult PLUGIN_API invalidateLayerRect (Steinberg::int32 layerId, const Steinberg::ViewRect* dirtyRect) = 0;
+
+	/** Notify the host that layers have been added, removed or moved. The host queries all layers and renders them again. */
+	virtual Steinberg::tresult PLUGIN_API layersChanged () = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugRenderingLayerFrame, 0x33f327ed, 0xd5884538, 0xb0bb6fdc, 0x5490b5ea)
+
+//************************************************************************************************
+// PlugViewTileGrid
+/** Helper to split an update rectangle into tiles for IPlugViewTiledRendering.
+
+	Inner tile edges are aligned to multiples of kTileAlignment pixels. With 4 bytes per pixel, no two
+	tiles touch the same 64 byte cache line, provided that scan0 and rowBytes of the target are multiples
+	of 64 bytes (e.g. targets using kSharedBitmapRowAlignment) and view coordinate 0 maps to the first
+	pixel column of the target.
+
+	With kCoordinateUnitScalablePoints, pass the ScalablePointMapping of the view. Tile widths are then
+	chosen in points so that inner edges map exactly to aligned pixel columns via ScalablePointMapping::toPixels().
+	For scale factors with a large denominator, the resulting minimum tile width (see getAlignment())
+	can exceed the requested width, i.e. tiles become wider.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewTileGrid
+{
+	static const Steinberg::int32 kTileAlignment = 16;
+
+	Steinberg::ViewRect rect;
+	Steinberg::int32 tileWidth;
+	Steinberg::int32 tileHeight;
+	Steinberg::int32 columns;
+	Steinberg::int32 rows;
+
+	/** Split rect into tiles of about the given size, all values in view coordinates. */
+	PlugViewTileGrid (const Steinberg::ViewRect& rect, Steinberg::int32 width = 256, Steinberg::int32 height = 64,
+					  const ScalablePointMapping& mapping = ScalablePointMapping ())
+	: rect (rect),
+	  tileWidth (getAlignment (mapping)),
+	  tileHeight (height < 1 ? 1 : height),
+	  columns (0),
+	  rows (0)
+	{
+		if(width > tileWidth)
+			tileWidth = (width / tileWidth) * tileWidth;
+
+		if(rect.right > rect.left && rect.bottom > rect.top)
+		{
+			columns = (getColumnEdge (rect.right - 1) - getColumnEdge (rect.left)) / tileWidth + 1;
+			rows = (rect.bottom - rect.top + tileHeight - 1) / tileHeight;
+		}
+	}
+
+	/**	Get minimum tile width in view coordinates, such that multiples of it map to multiples of
+		kTileAlignment pixels. */
+	static Steinberg::int32 getAlignment (const ScalablePointMapping& mapping)
+	{
+		Steinberg::int32 a = mapping.numerator, b = kTileAlignment;
+		while(b != 0)
+		{
+			Steinberg::int32 t = a % b;
+			a = b;
+			b = t;
+		}
+		return mapping.denominator * (kTileAlignment / a);
+	}
+
+	/** Get number of tiles. */
+	Steinberg::int32 getCount () const { return columns * rows; }
+
+	/** Get tile at given index. */
+	Steinberg::ViewRect getTile (Steinberg::int32 index) const
+	{
+		Steinberg::int32 column = index % (columns > 0 ? columns : 1);
+		Steinberg::int32 row = index / (columns > 0 ? columns : 1);
+
+		Steinberg::int32 left = getColumnEdge (rect.left) + column * tileWidth;
+		Steinberg::int32 top = rect.top + row * tileHeight;
+		Steinberg::ViewRect tile (left, top, left + tileWidth, top + tileHeight);
+		if(tile.left < rect.left)
+			tile.left = rect.left;
+		if(tile.right > rect.right)
+			tile.right = rect.right;
+		if(tile.bottom > rect.bottom)
+			tile.bottom = rect.bottom;
+		return tile;
+	}
+
+protected:
+	Steinberg::int32 getColumnEdge (Steinberg::int32 x) const
+	{
+		// round down to multiple of tile width, also for negative coordinates
+		return x >= 0 ? (x / tileWidth) * tileWidth : -((-x + tileWidth - 1) / tileWidth) * tileWidth;
+	}
+};
+
+//************************************************************************************************
+// IPlugViewSnapshotRendering
+/** Support for rendering downscaled snapshots, to be implemented by the VST3 IPlugView class.
+
+	Hosts can show previews of plug-in views, e.g. in browsers or channel overviews. Instead of
+	rendering at full size and scaling down, the plug-in renders directly at the size of the target,
+	which is usually an order of magnitude less pixel work. The host keeps the snapshot and only
+	requests a new one after it became outdated, at a rate suitable for previews.
+
+	A snapshot is considered outdated
+	- while the view is attached, after the view has been invalidated via IPlugRenderingFrame.
+	- while the view is not attached (no IPlugFrame), after the edit controller reported parameter
+	  changes via IComponentHandler::performEdit() or IComponentHandler::restartComponent(), e.g. with
+	  kParamValuesChanged, and after the host has loaded a new state into the component or controller.
+	- when the view is attached or removed.
+
+	Plug-ins whose appearance changes for other reasons while the view is not attached (e.g. a loaded
+	sample) can call IComponentHandler::restartComponent() with kParamValuesChanged to request a new snapshot.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewSnapshotRendering: Steinberg::FUnknown
+{
+	enum Quality
+	{
+		kSnapshotDraft = 0,	///< fast rendering, e.g. without text and fine details
+		kSnapshotHigh		///< best possible rendering at target size
+	};
+
+	/**	Render the whole view scaled to fit into the target (IBitmapAccessor), keeping the aspect ratio and
+		centering the result. Remaining pixels are transparent. Can be called in the UI thread while the
+		view is not attached. \return kResultOk on success, kNotImplemented for the given quality */
+	virtual Steinberg::tresult PLUGIN_API renderSnapshot (Steinberg::FUnknown* target, Steinberg::int32 quality) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewSnapshotRendering, 0xb73792c6, 0x117544a8, 0x83cefe91, 0x5b8ddb05)
+
+//************************************************************************************************
+// PlugViewDirtyRegion
+/** Helper to accumulate invalidated rectangles between two frames.
+
+	Rectangles are kept non-overlapping, as required by IPlugViewRendering2::renderRegion().
+	Overlapping rectangles are always merged, other rectangles are merged if the area of the
+	union doesn't exceed the sum of both areas plus kRectCost, i.e. if painting a few additional
+	pixels is cheaper than the overhead of a separate rectangle. If kMaxRects is exceeded, the
+	new rectangle is merged with the one causing the least additional area.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewDirtyRegion
+{
+	static const Steinberg::int32 kMaxRects = 16;
+	static const Steinberg::int64 kRectCost = 32 * 32;	///< estimated overhead per rectangle in pixels
+
+	Steinberg::int32 count;
+	Steinberg::ViewRect rects[kMaxRects];
+
+	PlugViewDirtyRegion (): count (0) {}
+
+	/** Remove all. */
+	void clear () { count = 0; }
+
+	/** Check if region is empty. */
+	bool isEmpty () const { return count == 0; }
+
+	/** Add rectangle to region. */
+	void addRect (const Steinberg::ViewRect& rect)
+	{
+		Steinberg::ViewRect r (rect);
+		if(r.right <= r.left || r.bottom <= r.top)
+			return;
+
+		for(Steinberg::int32 i = 0; i < count; i++)
+		{
+			const Steinberg::ViewRect& other = rects[i];
+			if(r.left >= other.left && r.top >= other.top && r.right <= other.right && r.bottom <= other.bottom)
+				return;
+		}
+
+		bool merged = true;
+		while(merged)
+		{
+			merged = false;
+			Steinberg::int32 bestIndex = -1;
+			Steinberg::int64 bestCost = 0;
+			for(Steinberg::int32 i = 0; i < count; i++)
+			{
+				Steinberg::int64 cost = getMergeCost (r, rects[i]);
+				if(bestIndex < 0 || cost < bestCost)
+				{
+					bestIndex = i;
+					bestCost = cost;
+				}
+				if(intersect (r, rects[i]))
+				{
+					bestIndex = i;
+					bestCost = 0;
+					break;
+				}
+			}
+
+			if(bestIndex >= 0 && (bestCost <= kRectCost || count == kMaxRects))
+			{
+				r = getUnion (r, rects[bestIndex]);
+				rects[bestIndex] = rects[--count];
+				merged = true;
+			}
+		}
+
+		rects[count++] = r;
+	}
+
+	/** Add all rectangles of another region. */
+	void addRegion (const PlugViewDirtyRegion& region)
+	{
+		for(Steinberg::int32 i = 0; i < region.count; i++)
+			addRect (region.rects[i]);
+	}
+
+	/** Get bounding box of all rectangles. */
+	Steinberg::ViewRect getBounds () const
+	{
+		if(count == 0)
+			return Steinberg::ViewRect ();
+		Steinberg::ViewRect bounds (rects[0]);
+		for(Steinberg::int32 i = 1; i < count; i++)
+			bounds = getUnion (bounds, rects[i]);
+		return bounds;
+	}
+
+	static Steinberg::int64 getArea (const Steinberg::ViewRect& r)
+	{
+		return Steinberg::int64 (r.right - r.left) * (r.bottom - r.top);
+	}
+
+	static Steinberg::ViewRect getUnion (const Steinberg::ViewRect& a, const Steinberg::ViewRect& b)
+	{
+		return Steinberg::ViewRect (a.left < b.left ? a.left : b.left, a.top < b.top ? a.top : b.top,
+									a.right > b.right ? a.right : b.right, a.bottom > b.bottom ? a.bottom : b.bottom);
+	}
+
+	static bool intersect (const Steinberg::ViewRect& a, const Steinberg::ViewRect& b)
+	{
+		return a.left < b.right && b.left < a.right && a.top < b.bottom && b.top < a.bottom;
+	}
+
+	/** Additional pixels painted when merging two rectangles. */
+	static Steinberg::int64 getMergeCost (const Steinberg::ViewRect& a, const Steinberg::ViewRect& b)
+	{
+		return getArea (getUnion (a, b)) - getArea (a) - getArea (b);
+	}
+};
+
 //************************************************************************************************
 // PlugViewMouseEvent
 //************************************************************************************************
@@ -196,6 +1187,277 @@ struct IPlugViewMouseInput: Steinberg::FUnknown
 
 DECLARE_CLASS_IID (IPlugViewMouseInput, 0xc13c4ea4, 0x868e4af7, 0x9614d52c, 0x7cd07b47)
 
+//************************************************************************************************
+// PlugViewTimedMouseEvent
+//************************************************************************************************
+
+struct PlugViewTimedMouseEvent
+{
+	PlugViewMouseEvent event;
+	Steinberg::int64 timestamp = 0;		///< time of event in nanoseconds (same clock as IPlugViewFrameTick)
+};
+
+//************************************************************************************************
+// IPlugViewMouseInput2
+/**	Extension to IPlugViewMouseInput for batched mouse input, to be implemented by the VST3 IPlugView class.
+
+	Instead of one call per event, the host collects mouse events and delivers them once per frame
+	before rendering, together with their original timestamps. Move events are not merged by the
+	host, so the plug-in can reconstruct the exact gesture path and velocity, or just use the
+	last position of a batch. Button events may be delivered immediately in a batch of their own.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewMouseInput2: IPlugViewMouseInput
+{
+	/**	Handling of multiple mouse events in chronological order.
+		\return kResultOk if events have been handled, kNotImplemented to receive them via onMouseEvent() instead */
+	virtual Steinberg::tresult PLUGIN_API onMouseEvents (const PlugViewTimedMouseEvent* events, Steinberg::int32 numEvents) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewMouseInput2, 0x56bc7b0f, 0x33ae45f3, 0x99b3c6be, 0x89fac169)
+
+//************************************************************************************************
+// PlugViewWheelEvent
+//************************************************************************************************
+
+struct PlugViewWheelEvent
+{
+	enum Flags
+	{
+		kContinuous = 1<<0,	///< high-resolution deltas from a touchpad or free-spinning wheel, may be fractional
+		kInverted = 1<<1	///< deltas are inverted by the system ("natural" scrolling)
+	};
+
+	Steinberg::int32 x = 0;				///< pointer position
+	Steinberg::int32 y = 0;				///< pointer position
+	float deltaX = 0.f;					///< horizontal distance in wheel steps (positive: right)
+	float deltaY = 0.f;					///< vertical distance in wheel steps (positive: up)
+	Steinberg::int16 modifiers = 0;		///< modifier keys
+	Steinberg::int16 flags = 0;			///< see Flags
+};
+
+//************************************************************************************************
+// PlugViewPointerEvent
+//************************************************************************************************
+
+struct PlugViewPointerEvent
+{
+	enum Type
+	{
+		kPointerDown,
+		kPointerUp,
+		kPointerMove,
+		kPointerCancel		///< pointer sequence has been cancelled by the system, e.g. by a gesture
+	};
+
+	enum PointerType
+	{
+		kTouch,
+		kPen,
+		kPenEraser
+	};
+
+	Steinberg::int32 type = kPointerDown;
+	Steinberg::int32 pointerType = kTouch;
+	Steinberg::int32 pointerId = 0;		///< identifies a touch or pen from down to up event, e.g. to track multiple fingers
+	Steinberg::int32 x = 0;
+	Steinberg::int32 y = 0;
+	float pressure = 1.f;				///< normalized pressure [0..1]
+	float tiltX = 0.f;					///< pen tilt in degrees [-90..90]
+	float tiltY = 0.f;					///< pen tilt in degrees [-90..90]
+	Steinberg::int16 modifiers = 0;
+	Steinberg::int64 timestamp = 0;		///< time of event in nanoseconds (same clock as IPlugViewFrameTick)
+};
+
+//************************************************************************************************
+// IPlugViewExtendedInput
+/**	Support for wheel, touch and pen input from host to plug-in view, to be implemented by the VST3 IPlugView class.
+	Can be combined with rendering via IPlugViewRendering interface, so that plug-ins requiring this kind of input
+	don't need a native child window. Coordinates use the same unit as IPlugViewMouseInput.
+
+	Keyboard input is delivered to rendered views via IPlugView::onKeyDown() and IPlugView::onKeyUp()
+	while the view has the focus (see IPlugView::onFocus()).
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewExtendedInput: Steinberg::FUnknown
+{
+	/** Handling of wheel events. \return kResultTrue if the event has been handled, otherwise the host may scroll its own container */
+	virtual Steinberg::tresult PLUGIN_API onWheelEvent (PlugViewWheelEvent* wheelEvent) = 0;
+
+	/** Handling of touch and pen events. \return kResultTrue if the event has been handled */
+	virtual Steinberg::tresult PLUGIN_API onPointerEvent (PlugViewPointerEvent* pointerEvent) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewExtendedInput, 0x932629f6, 0x3bc74884, 0xb931d841, 0xe667ada3)
+
+//************************************************************************************************
+// PlugViewInteractiveRegion
+/** Description of an interactive area, used with IPlugViewInteractiveRegions. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewInteractiveRegion
+{
+	enum Cursor
+	{
+		kCursorDefault = 0,
+		kCursorPointingHand,
+		kCursorIBeam,
+		kCursorCrosshair,
+		kCursorSizeHorizontal,
+		kCursorSizeVertical,
+		kCursorSizeAll,
+		kCursorGrab,
+		kCursorNotAllowed
+	};
+
+	enum Flags
+	{
+		kHoverEvents = 1<<0,	///< send kMouseEnter, kMouseMove and kMouseLeave while hovering, otherwise only button events
+		kWheelEvents = 1<<1		///< send wheel events, otherwise the host handles them
+	};
+
+	Steinberg::ViewRect rect;		///< area in view coordinates
+	Steinberg::int32 cursor = kCursorDefault;	///< cursor shape shown while hovering, see Cursor
+	Steinberg::int32 flags = 0;		///< see Flags
+};
+
+//************************************************************************************************
+// IPlugViewInteractiveRegions
+/**	Declaration of interactive areas of a rendered view, to be implemented by the VST3 IPlugView class.
+
+	The host forwards pointer events only if they hit one of the interactive regions and resolves
+	cursor shapes locally, so that moving the mouse over inert areas like backgrounds and labels
+	doesn't cause any calls to the plug-in. Regions later in the list are on top of earlier ones.
+	Once a button has been pressed inside of a region, all events are forwarded until it is released,
+	so that dragging works as usual.
+
+	The host queries the regions after the view is attached and when the plug-in signals a change
+	via IPlugInteractiveRegionFrame. If getInteractiveRegionCount() returns a negative value, all
+	events are forwarded.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewInteractiveRegions: Steinberg::FUnknown
+{
+	/** Get number of interactive regions. */
+	virtual Steinberg::int32 PLUGIN_API getInteractiveRegionCount () = 0;
+
+	/** Get interactive region at given index. */
+	virtual Steinberg::tresult PLUGIN_API getInteractiveRegion (Steinberg::int32 index, PlugViewInteractiveRegion& region) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewInteractiveRegions, 0xcdba46ef, 0xb7844fd3, 0x84055ebe, 0xaf54a1d8)
+
+//************************************************************************************************
+// IPlugInteractiveRegionFrame
+/** Callback interface for interactive regions. Implemented by host as extension to IPlugFrame.
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugInteractiveRegionFrame: Steinberg::FUnknown
+{
+	/** Notify the host that interactive regions have changed, e.g. after a layout change. */
+	virtual Steinberg::tresult PLUGIN_API interactiveRegionsChanged () = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugInteractiveRegionFrame, 0xa4e2d816, 0xa5494bc1, 0x8b504efa, 0x3724d669)
+
+//************************************************************************************************
+// PlugViewRenderStatistics
+/** Accumulated rendering statistics of a plug-in view, used with IPlugRenderingStatisticsFrame. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewRenderStatistics
+{
+	Steinberg::int64 startTime = 0;			///< begin of measurement period in nanoseconds (same clock as IPlugViewFrameTick)
+	Steinberg::int64 endTime = 0;			///< end of measurement period in nanoseconds
+	Steinberg::int64 renderCount = 0;		///< number of render calls
+	Steinberg::int64 renderedPixels = 0;	///< sum of rendered areas in pixels
+	Steinberg::int64 renderTime = 0;		///< sum of render durations in nanoseconds
+	Steinberg::int64 maxRenderTime = 0;		///< longest render call in nanoseconds
+	Steinberg::int64 invalidateCount = 0;	///< number of invalidateViewRect() calls
+	Steinberg::int64 invalidatedPixels = 0;	///< sum of invalidated areas in pixels
+	Steinberg::int64 skippedFrames = 0;		///< frames in which rendering was skipped or throttled by the host
+	Steinberg::int64 lateFrames = 0;		///< frames presented after their deadline because of this view
+};
+
+//************************************************************************************************
+// PlugViewRenderTraceEvent
+/** Single entry of a render trace, used with IPlugRenderingStatisticsFrame. @ingroup viewExt */
+//************************************************************************************************
+
+struct PlugViewRenderTraceEvent
+{
+	enum Type
+	{
+		kRender,		///< render call
+		kInvalidate,	///< invalidateViewRect() call, duration is zero
+		kFrameTick,		///< IPlugViewFrameTick::onFrameTick() call
+		kInput,			///< input event handling
+		kCustom			///< event added by the plug-in via IPlugRenderingStatisticsFrame::addTraceEvent()
+	};
+
+	static const Steinberg::int32 kMaxNameLength = 32;
+
+	Steinberg::int32 type = kRender;
+	char name[kMaxNameLength] = {0};		///< zero-terminated name for kCustom, empty otherwise
+	Steinberg::int64 startTime = 0;			///< start time in nanoseconds (same clock as IPlugViewFrameTick)
+	Steinberg::int64 duration = 0;			///< duration in nanoseconds
+	Steinberg::int64 pixels = 0;			///< rendered or invalidated area in pixels
+
+	/** Copy name, truncating it to kMaxNameLength - 1 characters. */
+	void setName (Steinberg::FIDString newName)
+	{
+		Steinberg::int32 length = 0;
+		if(newName)
+			for(; length < kMaxNameLength - 1 && newName[length] != 0; length++)
+				name[length] = newName[length];
+		name[length] = 0;
+	}
+};
+
+//************************************************************************************************
+// IPlugRenderingStatisticsFrame
+/** Access to rendering statistics of a plug-in view. Implemented by host as extension to IPlugFrame.
+
+	The host records render calls, invalidations, frame ticks and input handling per view instance
+	in a ring buffer (see PlugViewRenderTraceBuffer in pslrendertrace.h) and accumulates statistics, so that UI performance
+	problems can be attributed to individual plug-in views. Plug-ins can add their own trace events,
+	e.g. to mark expensive phases of rendering.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugRenderingStatisticsFrame: Steinberg::FUnknown
+{
+	/** Get statistics accumulated since the view has been attached. */
+	virtual Steinberg::tresult PLUGIN_API getRenderStatistics (PlugViewRenderStatistics& statistics) = 0;
+
+	/** Get most recent trace events in chronological order. \return number of events copied to events */
+	virtual Steinberg::int32 PLUGIN_API getRenderTrace (PlugViewRenderTraceEvent* events, Steinberg::int32 maxEvents) = 0;
+
+	/** Add custom trace event. The name is copied and truncated to PlugViewRenderTraceEvent::kMaxNameLength - 1
+		characters, the plug-in doesn't have to keep it alive. Can be called from any thread. */
+	virtual Steinberg::tresult PLUGIN_API addTraceEvent (Steinberg::FIDString name, Steinberg::int64 startTime, Steinberg::int64 duration) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugRenderingStatisticsFrame, 0x2ee354c4, 0xce1a441c, 0x940cd1e0, 0x5e753e9e)
+
 } // namespace Presonus
 
 #include "pluginterfaces/base/falignpop.h"
@@ -0,0 +1,66 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : ipslviewvisibility.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Plug-in View Visibility Interface
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _ipslviewvisibility_h
+#define _ipslviewvisibility_h
+
+#include "pluginterfaces/base/funknown.h"
+#include "pluginterfaces/base/falignpush.h"
+
+namespace Steinberg {
+struct ViewRect; }
+
+namespace Presonus {
+
+/** View visibility states. Used with IPlugViewVisibility. @ingroup viewExt */
+enum PlugViewVisibility
+{
+	kViewHidden = 0,			///< view is not visible, e.g. collapsed, scrolled out, in a background tab or minimized window
+	kViewPartiallyVisible,		///< view is partially scrolled out or occluded by other windows
+	kViewVisible				///< view is fully visible
+};
+
+//************************************************************************************************
+// IPlugViewVisibility
+/**	Notification about visibility of the plug-in view, to be implemented by the VST3 IPlugView class.
+
+	Applies to all kinds of attached views, i.e. embedded views (IPlugInViewEmbedding), rendered views
+	(IPlugViewRendering) and views in separate windows. While the view is hidden, the plug-in should
+	suspend animation timers, meter updates and invalidation. The host will not render hidden views.
+	The host calls onVisibilityChanged() after IPlugView::attached() and whenever the state or the
+	visible area changes. Views are considered visible until the first call.
+
+	@ingroup viewExt */
+//************************************************************************************************
+
+struct IPlugViewVisibility: Steinberg::FUnknown
+{
+	/**	Inform the view about its visibility (see PlugViewVisibility). visibleRect is the visible part of the
+		view in view coordinates, it is empty if the view is hidden and covers the whole view if it is fully visible. */
+	virtual Steinberg::tresult PLUGIN_API onVisibilityChanged (Steinberg::int32 visibility, const Steinberg::ViewRect* visibleRect) = 0;
+
+	static const Steinberg::FUID iid;
+};
+
+DECLARE_CLASS_IID (IPlugViewVisibility, 0xcd7450de, 0xe95f412b, 0xaa179412, 0x8a60e67a)
+
+} // namespace Presonus
+
+#include "pluginterfaces/base/falignpop.h"
+
+#endif // _ipslviewvisibility_h
\ No newline at end of file
@@ -0,0 +1,239 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : pslbitmapdelta.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Bitmap Delta Encoding Helpers
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _pslbitmapdelta_h
+#define _pslbitmapdelta_h
+
+#include "ipslviewrendering.h"
+
+namespace Presonus {
+
+/** @defgroup bitmapDelta Bitmap Delta Encoding
+
+Helpers for hosts transferring rendered plug-in views to remote displays.
+
+The view is divided into tiles of kTileSize x kTileSize pixels. After each frame, only tiles
+intersecting the rectangles passed to IPlugViewRendering::render() are hashed and compared to
+the previous frame, so unchanged tiles are skipped without touching their pixels. With
+kCoordinateUnitScalablePoints these rectangles are in points and are converted to the pixels
+they cover via ScalablePointMapping::getCoveringPixelRect(). Changed tiles
+can be run-length encoded, which works well for flat backgrounds and meters.
+*/
+
+//************************************************************************************************
+// BitmapTileDelta
+/**	Tracks which tiles of a bitmap have changed between frames.
+	Memory is allocated inline for up to maxTiles tiles, no allocations happen per frame.
+
+	Usage Example:
+
+	@code{.cpp}
+		BitmapTileDelta<> delta;
+		delta.setSize (width, height);
+
+		// per frame, after rendering updateRects into target
+		BitmapLockScope scope (target);
+		int32 changed[BitmapTileDelta<>::kMaxTiles];
+		int32 numChanged = delta.update (scope.data, updateRects, numRects, changed, BitmapTileDelta<>::kMaxTiles, mapping);
+		for(int32 i = 0; i < numChanged; i++)
+		{
+			int32 size = BitmapTileDelta<>::encodeTile (scope.data, delta.getTile (changed[i]), buffer, bufferSize);
+			// send tile index and encoded data, or raw pixels if size is negative
+		}
+	@endcode
+
+	@ingroup bitmapDelta */
+//************************************************************************************************
+
+template<Steinberg::int32 maxTiles = 4096>
+class BitmapTileDelta
+{
+public:
+	static const Steinberg::int32 kMaxTiles = maxTiles;
+	static const Steinberg::int32 kTileSize = 64;
+
+	BitmapTileDelta ()
+	: width (0),
+	  height (0),
+	  columns (0),
+	  rows (0)
+	{}
+
+	/** Set bitmap size, marks all tiles as changed. \return false if the bitmap has more than kMaxTiles tiles */
+	bool setSize (Steinberg::int32 w, Steinberg::int32 h)
+	{
+		Steinberg::int32 c = (w + kTileSize - 1) / kTileSize;
+		Steinberg::int32 r = (h + kTileSize - 1) / kTileSize;
+		if(w < 0 || h < 0 || c * r > kMaxTiles)
+			return false;
+
+		width = w;
+		height = h;
+		columns = c;
+		rows = r;
+		invalidate ();
+		return true;
+	}
+
+	/** Mark all tiles as changed, e.g. when a new remote viewer connects. */
+	void invalidate ()
+	{
+		for(Steinberg::int32 i = 0; i < columns * rows; i++)
+		{
+			hashes[i] = 0;
+			valid[i] = false;
+		}
+	}
+
+	/** Get number of tiles. */
+	Steinberg::int32 getTileCount () const { return columns * rows; }
+
+	/** Get rectangle of tile in pixels. */
+	Steinberg::ViewRect getTile (Steinberg::int32 index) const
+	{
+		Steinberg::int32 left = (index % columns) * kTileSize;
+		Steinberg::int32 top = (index / columns) * kTileSize;
+		return Steinberg::ViewRect (left, top, left + kTileSize < width ? left + kTileSize : width,
+									top + kTileSize < height ? top + kTileSize : height);
+	}
+
+	/**	Compare tiles intersecting the given rectangles with the previous frame. dirtyRects are in view coordinates,
+		mapping converts them to pixels (see ScalablePointMapping::getCoveringPixelRect()), pass the mapping of
+		the view if it uses kCoordinateUnitScalablePoints. Tiles which have never been
+		transferred are always reported. If more than maxChanged tiles have changed, e.g. because the caller
+		limits the bandwidth per frame, the remaining dirty tiles are not compared but marked as changed,
+		so they are reported by the next call even without new damage.
+		\return number of changed tile indices written to changedTiles */
+	Steinberg::int32 update (const BitmapPixelBuffer& buffer, const Steinberg::ViewRect* dirtyRects, Steinberg::int32 numRects,
+							 Steinberg::int32* changedTiles, Steinberg::int32 maxChanged, const ScalablePointMapping& mapping = ScalablePointMapping ())
+	{
+		if(buffer.width != width || buffer.height != height)
+			return 0;
+
+		Steinberg::int32 numChanged = 0;
+		for(Steinberg::int32 index = 0; index < columns * rows; index++)
+		{
+			Steinberg::ViewRect tile = getTile (index);
+			bool dirty = !valid[index];
+			for(Steinberg::int32 i = 0; i < numRects && !dirty; i++)
+				dirty = PlugViewDirtyRegion::intersect (tile, mapping.getCoveringPixelRect (dirtyRects[i]));
+			if(!dirty)
+				continue;
+
+			if(numChanged >= maxChanged)
+			{
+				valid[index] = false; // report with next call
+				continue;
+			}
+
+			Steinberg::uint64 hash = hashTile (buffer, tile);
+			if(valid[index] && hash == hashes[index])
+				continue;
+
+			hashes[index] = hash;
+			valid[index] = true;
+			changedTiles[numChanged++] = index;
+		}
+		return numChanged;
+	}
+
+	/** Calculate hash of pixels in given rectangle. */
+	static Steinberg::uint64 hashTile (const BitmapPixelBuffer& buffer, const Steinberg::ViewRect& tile)
+	{
+		Steinberg::int32 bytesPerPixel = BitmapPixelScroller::getBytesPerPixel (buffer.format);
+		Steinberg::int32 length = tile.getWidth () * bytesPerPixel;
+		const Steinberg::uint8* base = static_cast<const Steinberg::uint8*> (buffer.scan0);
+
+		Steinberg::uint64 hash = 0xcbf29ce484222325ull;
+		for(Steinberg::int32 y = tile.top; y < tile.bottom; y++)
+		{
+			const Steinberg::uint8* row = base + Steinberg::int64 (y) * buffer.rowBytes + Steinberg::int64 (tile.left) * bytesPerPixel;
+			Steinberg::int32 x = 0;
+			for(; x + 8 <= length; x += 8)
+			{
+				Steinberg::uint64 word;
+				std::memcpy (&word, row + x, 8);
+				hash = (hash ^ word) * 0x100000001b3ull;
+				hash ^= hash >> 29;
+			}
+			for(; x < length; x++)
+				hash = (hash ^ row[x]) * 0x100000001b3ull;
+		}
+		return hash;
+	}
+
+	/**	Run-length encode pixels of given rectangle (4 bytes per pixel formats only). Each run is stored
+		as 16 bit little-endian run length followed by the pixel value (4 bytes), rows are concatenated.
+		\return number of bytes written, or -1 if the output doesn't fit or isn't smaller than raw pixels */
+	static Steinberg::int32 encodeTile (const BitmapPixelBuffer& buffer, const Steinberg::ViewRect& tile, Steinberg::uint8* output, Steinberg::int32 maxBytes)
+	{
+		if(BitmapPixelScroller::getBytesPerPixel (buffer.format) != 4)
+			return -1;
+
+		Steinberg::int32 rawSize = tile.getWidth () * tile.getHeight () * 4;
+		Steinberg::int32 limit = maxBytes < rawSize ? maxBytes : rawSize - 1;
+		Steinberg::int32 size = 0;
+		const Steinberg::uint8* base = static_cast<const Steinberg::uint8*> (buffer.scan0);
+
+		Steinberg::uint32 value = 0;
+		Steinberg::int32 run = 0;
+		for(Steinberg::int32 y = tile.top; y < tile.bottom; y++)
+		{
+			const Steinberg::uint8* row = base + Steinberg::int64 (y) * buffer.rowBytes;
+			for(Steinberg::int32 x = tile.left; x < tile.right; x++)
+			{
+				Steinberg::uint32 pixel;
+				std::memcpy (&pixel, row + Steinberg::int64 (x) * 4, 4);
+				if(run > 0 && (pixel != value || run == 0xffff))
+				{
+					if(!writeRun (output, size, limit, run, value))
+						return -1;
+					run = 0;
+				}
+				value = pixel;
+				run++;
+			}
+		}
+		if(run > 0 && !writeRun (output, size, limit, run, value))
+			return -1;
+		return size;
+	}
+
+protected:
+	Steinberg::int32 width;
+	Steinberg::int32 height;
+	Steinberg::int32 columns;
+	Steinberg::int32 rows;
+	Steinberg::uint64 hashes[kMaxTiles];
+	bool valid[kMaxTiles];
+
+	static bool writeRun (Steinberg::uint8* output, Steinberg::int32& size, Steinberg::int32 limit, Steinberg::int32 run, Steinberg::uint32 value)
+	{
+		if(size + 6 > limit)
+			return false;
+		output[size++] = Steinberg::uint8 (run & 0xff);
+		output[size++] = Steinberg::uint8 (run >> 8);
+		std::memcpy (output + size, &value, 4);
+		size += 4;
+		return true;
+	}
+};
+
+} // namespace Presonus
+
+#endif // _pslbitmapdelta_h
\ No newline at end of file
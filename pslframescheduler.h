@@ -0,0 +1,250 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : pslframescheduler.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Frame Scheduling Helpers
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _pslframescheduler_h
+#define _pslframescheduler_h
+
+#include "ipslviewrendering.h"
+#include "ipslviewvisibility.h"
+
+namespace Presonus {
+
+/** @defgroup frameScheduling Frame Scheduling
+
+Helpers for hosts driving many rendered plug-in views from a single frame clock, see IPlugViewRenderScheduling.
+*/
+
+//************************************************************************************************
+// PlugViewFrameScheduler
+/**	Decides which views are rendered in a frame, without creating any threads.
+
+	The host registers each view with its PlugViewSchedulingInfo and reports visibility, focus and
+	invalidations. Once per frame tick, schedule() selects the views to render, which the host then
+	renders in the UI thread or on its worker threads, and reports back via onRendered().
+
+	- Hidden views are never rendered.
+	- Focused, fully visible views are rendered at up to preferredFrameRate. A preferredFrameRate of zero
+	  (static content) means the view is rendered whenever it has been invalidated, at most once per frame.
+	- Other views are throttled to the background frame rate chosen by the host (see setBackgroundFrameRate()),
+	  raised to the view's minFrameRate and limited to its preferredFrameRate if these are not zero.
+	- Invalidated views which are due are rendered in the order focused, fully visible, partially visible,
+	  longest waiting first, up to the given maximum number of renders per frame.
+
+	An invalidated view which is not rendered in a frame, due to throttling or because the maximum number of
+	renders has been reached, counts as a skipped frame. A render finishing after the presentation time of
+	its frame counts as a late frame. Memory is allocated inline for up to maxViews views.
+
+	@ingroup frameScheduling */
+//************************************************************************************************
+
+template<Steinberg::int32 maxViews = 64>
+class PlugViewFrameScheduler
+{
+public:
+	static const Steinberg::int32 kMaxViews = maxViews;
+	static const Steinberg::int32 kDefaultBackgroundFrameRate = 15;
+
+	PlugViewFrameScheduler ()
+	: backgroundFrameRate (float (kDefaultBackgroundFrameRate))
+	{}
+
+	/** Set frame rate for views without focus or partially visible views, zero for no throttling. */
+	void setBackgroundFrameRate (float rate) { backgroundFrameRate = rate > 0.f ? rate : 0.f; }
+
+	/** Get frame rate for views without focus or partially visible views. */
+	float getBackgroundFrameRate () const { return backgroundFrameRate; }
+
+	/** Add view, time is the start of the measurement period. \return view index, -1 if all slots are in use */
+	Steinberg::int32 addView (const PlugViewSchedulingInfo& info, Steinberg::int64 time)
+	{
+		for(Steinberg::int32 i = 0; i < kMaxViews; i++)
+			if(views[i].used == false)
+			{
+				views[i] = ViewState ();
+				views[i].used = true;
+				views[i].info = info;
+				views[i].statistics.startTime = views[i].statistics.endTime = time;
+				return i;
+			}
+		return -1;
+	}
+
+	/** Remove view. */
+	void removeView (Steinberg::int32 index)
+	{
+		if(isValid (index))
+			views[index].used = false;
+	}
+
+	/** Update scheduling information, e.g. after IPlugViewRenderScheduling::getSchedulingInfo(). */
+	void setSchedulingInfo (Steinberg::int32 index, const PlugViewSchedulingInfo& info)
+	{
+		if(isValid (index))
+			views[index].info = info;
+	}
+
+	/** Set visibility (see PlugViewVisibility). */
+	void setVisibility (Steinberg::int32 index, Steinberg::int32 visibility)
+	{
+		if(isValid (index))
+			views[index].visibility = visibility;
+	}
+
+	/** Set keyboard focus state. */
+	void setFocused (Steinberg::int32 index, bool state)
+	{
+		if(isValid (index))
+			views[index].focused = state;
+	}
+
+	/** Report invalidateViewRect() call with given area in pixels. */
+	void invalidate (Steinberg::int32 index, Steinberg::int64 pixels)
+	{
+		if(isValid (index) == false)
+			return;
+
+		ViewState& view = views[index];
+		view.dirty = true;
+		view.statistics.invalidateCount++;
+		view.statistics.invalidatedPixels += pixels;
+	}
+
+	/**	Select views to render in the frame presented at frameTime, both in nanoseconds as passed to
+		IPlugViewFrameTick::onFrameTick(). result receives up to kMaxViews view indices in render order.
+		The invalidated state of the selected views is reset. \return number of views to render */
+	Steinberg::int32 schedule (Steinberg::int64 frameTime, Steinberg::int64 frameInterval, Steinberg::int32 maxRenders, Steinberg::int32* result)
+	{
+		Steinberg::int32 numDue = 0;
+		for(Steinberg::int32 i = 0; i < kMaxViews; i++)
+		{
+			ViewState& view = views[i];
+			if(view.used == false)
+				continue;
+
+			view.statistics.endTime = frameTime;
+			if(view.dirty == false || view.visibility == kViewHidden)
+				continue;
+
+			// tolerate half a frame, so that rates close to the display rate don't alternate
+			if(view.nextFrameTime > frameTime + frameInterval / 2)
+			{
+				view.statistics.skippedFrames++;
+				continue;
+			}
+
+			// insert sorted by priority
+			Steinberg::int32 position = numDue++;
+			for(; position > 0 && isBefore (i, result[position - 1]); position--)
+				result[position] = result[position - 1];
+			result[position] = i;
+		}
+
+		Steinberg::int32 numScheduled = numDue < maxRenders ? numDue : maxRenders;
+		for(Steinberg::int32 n = 0; n < numDue; n++)
+		{
+			ViewState& view = views[result[n]];
+			if(n >= numScheduled)
+			{
+				view.statistics.skippedFrames++;
+				continue;
+			}
+
+			view.dirty = false;
+			view.deadline = frameTime;
+			view.nextFrameTime = frameTime + getFrameDuration (view);
+		}
+		return numScheduled;
+	}
+
+	/** Report completed render of a view, times in nanoseconds. */
+	void onRendered (Steinberg::int32 index, Steinberg::int64 startTime, Steinberg::int64 duration, Steinberg::int64 pixels)
+	{
+		if(isValid (index) == false)
+			return;
+
+		PlugViewRenderStatistics& statistics = views[index].statistics;
+		statistics.renderCount++;
+		statistics.renderedPixels += pixels;
+		statistics.renderTime += duration;
+		if(duration > statistics.maxRenderTime)
+			statistics.maxRenderTime = duration;
+		if(startTime + duration > views[index].deadline)
+			statistics.lateFrames++;
+	}
+
+	/** Get statistics of a view, e.g. for IPlugRenderingStatisticsFrame::getRenderStatistics(). */
+	const PlugViewRenderStatistics& getStatistics (Steinberg::int32 index) const { return views[index].statistics; }
+
+	/** Check if index refers to a registered view. */
+	bool isValid (Steinberg::int32 index) const { return index >= 0 && index < kMaxViews && views[index].used; }
+
+protected:
+	struct ViewState
+	{
+		bool used = false;
+		bool focused = false;
+		bool dirty = false;
+		Steinberg::int32 visibility = kViewVisible;
+		Steinberg::int64 nextFrameTime = 0;
+		Steinberg::int64 deadline = 0;
+		PlugViewSchedulingInfo info;
+		PlugViewRenderStatistics statistics;
+	};
+
+	ViewState views[kMaxViews];
+	float backgroundFrameRate;
+
+	bool isThrottled (const ViewState& view) const
+	{
+		return view.focused == false || view.visibility != kViewVisible;
+	}
+
+	Steinberg::int64 getFrameDuration (const ViewState& view) const
+	{
+		float rate = view.info.preferredFrameRate;
+		if(isThrottled (view) && backgroundFrameRate > 0.f)
+		{
+			float backgroundRate = backgroundFrameRate;
+			if(view.info.minFrameRate > backgroundRate)
+				backgroundRate = view.info.minFrameRate;
+			if(rate <= 0.f || backgroundRate < rate)
+				rate = backgroundRate;
+		}
+		return rate > 0.f ? Steinberg::int64 (1000000000. / rate) : 0;
+	}
+
+	Steinberg::int32 getPriority (const ViewState& view) const
+	{
+		if(view.focused && view.visibility == kViewVisible)
+			return 0;
+		return view.visibility == kViewVisible ? 1 : 2;
+	}
+
+	bool isBefore (Steinberg::int32 a, Steinberg::int32 b) const
+	{
+		Steinberg::int32 priorityA = getPriority (views[a]);
+		Steinberg::int32 priorityB = getPriority (views[b]);
+		if(priorityA != priorityB)
+			return priorityA < priorityB;
+		return views[a].nextFrameTime < views[b].nextFrameTime;
+	}
+};
+
+} // namespace Presonus
+
+#endif // _pslframescheduler_h
\ No newline at end of file
@@ -0,0 +1,491 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : pslrenderbench.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Rendering Benchmark Helpers
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _pslrenderbench_h
+#define _pslrenderbench_h
+
+#include "ipslviewrendering.h"
+
+#include <atomic>
+
+namespace Presonus {
+
+/** @defgroup renderBench Rendering Benchmarks
+
+Helpers for measuring rendering performance of plug-in views without a display, e.g. in regression tests.
+
+A headless host renders into a MemoryBitmapAccessor, drives IPlugViewRendering::render() with rectangles
+from PlugViewDirtyRectGenerator and IPlugViewMouseInput with events from PlugViewMouseEventGenerator, and
+records the duration and number of memory allocations of each frame in a PlugViewFrameTimeRecorder, with
+allocations counted via PlugViewAllocationCounter. All generators are deterministic for a given seed, so
+results of different runs and plug-in versions can be compared.
+*/
+
+//************************************************************************************************
+// MemoryBitmapAccessor
+/** IBitmapAccessor implementation for a pixel buffer owned by the caller.
+
+	Can be used as rendering target without any windowing system, e.g. in a headless host measuring
+	rendering performance or in unit tests. The object is not reference counted, the owner has to keep
+	it alive while it is in use. The lock count can be used to verify how often the plug-in locks
+	the target per frame.
+	@ingroup renderBench */
+//************************************************************************************************
+
+class MemoryBitmapAccessor: public IBitmapAccessor
+{
+public:
+	MemoryBitmapAccessor (const BitmapPixelBuffer& buffer)
+	: buffer (buffer),
+	  lockCount (0)
+	{}
+
+	/** Get pixel buffer. */
+	const BitmapPixelBuffer& getBuffer () const { return buffer; }
+
+	/** Get number of lockPixelBuffer() calls since last reset. */
+	Steinberg::int32 getLockCount () const { return lockCount; }
+
+	/** Reset lock count, e.g. at the beginning of a frame. */
+	void resetLockCount () { lockCount = 0; }
+
+	// IBitmapAccessor
+	Steinberg::tresult PLUGIN_API lockPixelBuffer (BitmapPixelBuffer* result)
+	{
+		if(result == nullptr)
+			return Steinberg::kInvalidArgument;
+		*result = buffer;
+		lockCount++;
+		return Steinberg::kResultOk;
+	}
+
+	Steinberg::tresult PLUGIN_API unlockPixelBuffer (BitmapPixelBuffer* result)
+	{
+		return Steinberg::kResultOk;
+	}
+
+	// FUnknown
+	Steinberg::tresult PLUGIN_API queryInterface (const Steinberg::TUID _iid, void** obj)
+	{
+		QUERY_INTERFACE (_iid, obj, Steinberg::FUnknown::iid, IBitmapAccessor)
+		QUERY_INTERFACE (_iid, obj, IBitmapAccessor::iid, IBitmapAccessor)
+		*obj = nullptr;
+		return Steinberg::kNoInterface;
+	}
+
+	Steinberg::uint32 PLUGIN_API addRef () { return 1; }
+	Steinberg::uint32 PLUGIN_API release () { return 1; }
+
+protected:
+	BitmapPixelBuffer buffer;
+	Steinberg::int32 lockCount;
+};
+
+//************************************************************************************************
+// PlugViewRandomGenerator
+/** Small deterministic pseudo random number generator (xorshift32), identical on all platforms.
+	@ingroup renderBench */
+//************************************************************************************************
+
+struct PlugViewRandomGenerator
+{
+	Steinberg::uint32 state;
+
+	PlugViewRandomGenerator (Steinberg::uint32 seed = 1)
+	: state (seed != 0 ? seed : 1)
+	{}
+
+	/** Get next value. */
+	Steinberg::uint32 next ()
+	{
+		state ^= state << 13;
+		state ^= state >> 17;
+		state ^= state << 5;
+		return state;
+	}
+
+	/** Get next value in range [min, max). */
+	Steinberg::int32 next (Steinberg::int32 min, Steinberg::int32 max)
+	{
+		return max > min ? min + Steinberg::int32 (next () % Steinberg::uint32 (max - min)) : min;
+	}
+};
+
+//************************************************************************************************
+// PlugViewDirtyRectGenerator
+/** Generates invalidated rectangles per frame for a typical update pattern.
+	@ingroup renderBench */
+//************************************************************************************************
+
+class PlugViewDirtyRectGenerator
+{
+public:
+	enum Pattern
+	{
+		kFullView,		///< whole view in every frame
+		kMeters,		///< narrow vertical strips with changing height, like level meters
+		kRandomRects,	///< small rectangles at random positions, like controls changed by automation
+		kScrolling		///< strip at the right edge, like a scrolling waveform (see IPlugRenderingFrameScrolling)
+	};
+
+	PlugViewDirtyRectGenerator (const Steinberg::ViewRect& viewRect, Steinberg::int32 pattern, Steinberg::uint32 seed = 1)
+	: viewRect (viewRect),
+	  pattern (pattern),
+	  random (seed)
+	{}
+
+	/** Get rectangles for next frame. \return number of rectangles written to rects */
+	Steinberg::int32 next (Steinberg::ViewRect* rects, Steinberg::int32 maxRects)
+	{
+		Steinberg::int32 width = viewRect.right - viewRect.left;
+		Steinberg::int32 height = viewRect.bottom - viewRect.top;
+		if(width <= 0 || height <= 0 || maxRects <= 0)
+			return 0;
+
+		switch(pattern)
+		{
+		case kMeters :
+			{
+				static const Steinberg::int32 kMeterWidth = 8;
+				static const Steinberg::int32 kMeterSpacing = 24;
+				Steinberg::int32 count = 0;
+				for(Steinberg::int32 x = viewRect.left; x + kMeterWidth <= viewRect.right && count < maxRects; x += kMeterSpacing)
+				{
+					Steinberg::int32 top = viewRect.top + random.next (0, height);
+					rects[count++] = Steinberg::ViewRect (x, top, x + kMeterWidth, viewRect.bottom);
+				}
+				return count;
+			}
+
+		case kRandomRects :
+			{
+				Steinberg::int32 count = random.next (1, maxRects < 4 ? maxRects + 1 : 5);
+				for(Steinberg::int32 i = 0; i < count; i++)
+				{
+					Steinberg::int32 w = random.next (1, width < 48 ? width + 1 : 49);
+					Steinberg::int32 h = random.next (1, height < 48 ? height + 1 : 49);
+					Steinberg::int32 left = viewRect.left + random.next (0, width - w + 1);
+					Steinberg::int32 top = viewRect.top + random.next (0, height - h + 1);
+					rects[i] = Steinberg::ViewRect (left, top, left + w, top + h);
+				}
+				return count;
+			}
+
+		case kScrolling :
+			{
+				static const Steinberg::int32 kStripWidth = 4;
+				Steinberg::int32 left = viewRect.right - (width < kStripWidth ? width : kStripWidth);
+				rects[0] = Steinberg::ViewRect (left, viewRect.top, viewRect.right, viewRect.bottom);
+				return 1;
+			}
+
+		default :
+			rects[0] = viewRect;
+			return 1;
+		}
+	}
+
+protected:
+	Steinberg::ViewRect viewRect;
+	Steinberg::int32 pattern;
+	PlugViewRandomGenerator random;
+};
+
+//************************************************************************************************
+// PlugViewMouseEventGenerator
+/**	Generates a stream of mouse events simulating a user dragging controls: the mouse enters the view,
+	moves to a random position, drags for a number of events, releases the button and eventually leaves.
+	@ingroup renderBench */
+//************************************************************************************************
+
+class PlugViewMouseEventGenerator
+{
+public:
+	PlugViewMouseEventGenerator (const Steinberg::ViewRect& viewRect, Steinberg::uint32 seed = 1, Steinberg::int32 dragLength = 32)
+	: viewRect (viewRect),
+	  random (seed),
+	  dragLength (dragLength < 1 ? 1 : dragLength),
+	  state (kOutside),
+	  remaining (0),
+	  x (viewRect.left),
+	  y (viewRect.top)
+	{}
+
+	/** Get next event. */
+	PlugViewMouseEvent next ()
+	{
+		PlugViewMouseEvent e;
+		switch(state)
+		{
+		case kOutside :
+			moveTo (random.next (viewRect.left, viewRect.right), random.next (viewRect.top, viewRect.bottom));
+			e.type = PlugViewMouseEvent::kMouseEnter;
+			state = kHovering;
+			remaining = random.next (1, 8);
+			break;
+
+		case kHovering :
+			if(remaining-- > 0)
+			{
+				moveBy (random.next (-8, 9), random.next (-8, 9));
+				e.type = PlugViewMouseEvent::kMouseMove;
+			}
+			else
+			{
+				e.type = PlugViewMouseEvent::kMouseDown;
+				state = kDragging;
+				remaining = dragLength;
+			}
+			break;
+
+		case kDragging :
+			if(remaining-- > 0)
+			{
+				moveBy (random.next (-2, 3), random.next (-4, 5));
+				e.type = PlugViewMouseEvent::kMouseMove;
+			}
+			else
+			{
+				e.type = PlugViewMouseEvent::kMouseUp;
+				state = random.next (0, 4) == 0 ? kLeaving : kHovering;
+				remaining = random.next (1, 8);
+			}
+			break;
+
+		default :
+			e.type = PlugViewMouseEvent::kMouseLeave;
+			state = kOutside;
+			break;
+		}
+
+		e.button = PlugViewMouseEvent::kLeftButton;
+		e.x = x;
+		e.y = y;
+		return e;
+	}
+
+protected:
+	enum State
+	{
+		kOutside,
+		kHovering,
+		kDragging,
+		kLeaving
+	};
+
+	Steinberg::ViewRect viewRect;
+	PlugViewRandomGenerator random;
+	Steinberg::int32 dragLength;
+	Steinberg::int32 state;
+	Steinberg::int32 remaining;
+	Steinberg::int32 x;
+	Steinberg::int32 y;
+
+	void moveTo (Steinberg::int32 newX, Steinberg::int32 newY)
+	{
+		x = newX < viewRect.left ? viewRect.left : newX >= viewRect.right ? viewRect.right - 1 : newX;
+		y = newY < viewRect.top ? viewRect.top : newY >= viewRect.bottom ? viewRect.bottom - 1 : newY;
+	}
+
+	void moveBy (Steinberg::int32 dx, Steinberg::int32 dy)
+	{
+		moveTo (x + dx, y + dy);
+	}
+};
+
+//************************************************************************************************
+// PlugViewAllocationCounter
+/**	Process-wide counter of memory allocations, fed by an allocation hook provided by the host.
+
+	The benchmark host replaces the global allocation functions of its executable and calls count()
+	from there. On Linux, replacing malloc() and operator new in the executable also covers allocations
+	made by plug-in modules, as long as these don't link the C++ runtime statically.
+
+	@code{.cpp}
+		void* operator new (size_t size)
+		{
+			PlugViewAllocationCounter::count ();
+			if(void* p = malloc (size))
+				return p;
+			throw std::bad_alloc ();
+		}
+
+		// per frame
+		int64 allocationsBefore = PlugViewAllocationCounter::get ();
+		view->render (&target, &updateRect);
+		recorder.add (renderDuration, PlugViewAllocationCounter::get () - allocationsBefore);
+	@endcode
+
+	@ingroup renderBench */
+//************************************************************************************************
+
+struct PlugViewAllocationCounter
+{
+	/** Count one allocation, can be called from any thread. */
+	static void count () { getCounter ().fetch_add (1, std::memory_order_relaxed); }
+
+	/** Get number of allocations counted so far. */
+	static Steinberg::int64 get () { return getCounter ().load (std::memory_order_relaxed); }
+
+	static std::atomic<Steinberg::int64>& getCounter ()
+	{
+		static std::atomic<Steinberg::int64> counter (0);
+		return counter;
+	}
+};
+
+//************************************************************************************************
+// PlugViewFrameTimeRecorder
+/**	Records frame durations and allocations per frame and computes frames per second and percentiles.
+	Memory is allocated inline for up to maxFrames frames, further frames are ignored.
+	@ingroup renderBench */
+//************************************************************************************************
+
+template<Steinberg::int32 maxFrames = 4096>
+class PlugViewFrameTimeRecorder
+{
+public:
+	static const Steinberg::int32 kMaxFrames = maxFrames;
+
+	PlugViewFrameTimeRecorder ()
+	: count (0),
+	  totalTime (0),
+	  totalAllocations (0),
+	  sorted (true)
+	{}
+
+	/** Remove all frames. */
+	void clear ()
+	{
+		count = 0;
+		totalTime = 0;
+		totalAllocations = 0;
+		sorted = true;
+	}
+
+	/** Add duration of a frame in nanoseconds and number of allocations made during the frame (see PlugViewAllocationCounter). */
+	void add (Steinberg::int64 duration, Steinberg::int64 numAllocations = 0)
+	{
+		if(count >= kMaxFrames)
+			return;
+		durations[count] = duration;
+		allocations[count] = numAllocations;
+		count++;
+		totalTime += duration;
+		totalAllocations += numAllocations;
+		sorted = false;
+	}
+
+	/** Get number of recorded frames. */
+	Steinberg::int32 getCount () const { return count; }
+
+	/** Get frames per second if frames are rendered back to back. */
+	double getFramesPerSecond () const
+	{
+		return totalTime > 0 ? double (count) * 1000000000. / double (totalTime) : 0.;
+	}
+
+	/** Get duration in nanoseconds below which the given percentage of frames is, e.g. 50, 95 or 99 (nearest rank). */
+	Steinberg::int64 getPercentile (double percent)
+	{
+		sort ();
+		return getPercentile (durations, percent);
+	}
+
+	/** Get longest frame duration in nanoseconds. */
+	Steinberg::int64 getMaximum () { return getPercentile (100.); }
+
+	/** Get number of allocations per frame below which the given percentage of frames is (nearest rank). */
+	Steinberg::int64 getAllocationPercentile (double percent)
+	{
+		sort ();
+		return getPercentile (allocations, percent);
+	}
+
+	/** Get highest number of allocations in a single frame. */
+	Steinberg::int64 getMaximumAllocations () { return getAllocationPercentile (100.); }
+
+	/** Get average number of allocations per frame. */
+	double getAverageAllocations () const
+	{
+		return count > 0 ? double (totalAllocations) / double (count) : 0.;
+	}
+
+protected:
+	Steinberg::int64 durations[kMaxFrames];
+	Steinberg::int64 allocations[kMaxFrames];
+	Steinberg::int32 count;
+	Steinberg::int64 totalTime;
+	Steinberg::int64 totalAllocations;
+	bool sorted;
+
+	Steinberg::int64 getPercentile (const Steinberg::int64* values, double percent) const
+	{
+		if(count == 0)
+			return 0;
+
+		double position = percent / 100. * count;
+		Steinberg::int32 rank = Steinberg::int32 (position);
+		if(rank < position)
+			rank++;
+		rank = rank < 1 ? 1 : rank > count ? count : rank;
+		return values[rank - 1];
+	}
+
+	void sort ()
+	{
+		if(sorted)
+			return;
+		sort (durations);
+		sort (allocations);
+		sorted = true;
+	}
+
+	// heap sort, no allocations and no recursion
+	void sort (Steinberg::int64* values)
+	{
+		for(Steinberg::int32 i = count / 2 - 1; i >= 0; i--)
+			siftDown (values, i, count);
+		for(Steinberg::int32 end = count - 1; end > 0; end--)
+		{
+			Steinberg::int64 temp = values[0];
+			values[0] = values[end];
+			values[end] = temp;
+			siftDown (values, 0, end);
+		}
+	}
+
+	static void siftDown (Steinberg::int64* values, Steinberg::int32 root, Steinberg::int32 end)
+	{
+		for(Steinberg::int32 child = 2 * root + 1; child < end; child = 2 * root + 1)
+		{
+			if(child + 1 < end && values[child + 1] > values[child])
+				child++;
+			if(values[root] >= values[child])
+				return;
+			Steinberg::int64 temp = values[root];
+			values[root] = values[child];
+			values[child] = temp;
+			root = child;
+		}
+	}
+};
+
+} // namespace Presonus
+
+#endif // _pslrenderbench_h
\ No newline at end of file
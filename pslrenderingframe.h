@@ -0,0 +1,146 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : pslrenderingframe.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Rendering Frame Helpers
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _pslrenderingframe_h
+#define _pslrenderingframe_h
+
+#include "ipslviewrendering.h"
+
+namespace Presonus {
+
+/** @defgroup renderingFrame Rendering Frame
+
+Reference implementation of host-driven frame pacing for rendered plug-in views, see IPlugRenderingFrame2.
+*/
+
+//************************************************************************************************
+// PlugRenderingFrame
+/**	IPlugRenderingFrame2 implementation which collects invalidated rectangles in a PlugViewDirtyRegion
+	and renders the view at most once per display refresh.
+
+	The host returns this object when the plug-in queries IPlugRenderingFrame or IPlugRenderingFrame2
+	from its IPlugFrame, and calls onDisplayRefresh() from its display link or vsync callback in the
+	UI thread. The object is not reference counted, the owner has to keep it alive while the view is attached.
+
+	Usage Example:
+
+	@code{.cpp}
+		PlugRenderingFrame renderingFrame (plugView);
+
+		// per display refresh
+		renderingFrame.onDisplayRefresh (target, frameTime, frameInterval);
+	@endcode
+
+	@ingroup renderingFrame */
+//************************************************************************************************
+
+class PlugRenderingFrame: public IPlugRenderingFrame2
+{
+public:
+	PlugRenderingFrame (Steinberg::FUnknown* view)
+	: rendering (nullptr),
+	  rendering2 (nullptr),
+	  frameTick (nullptr),
+	  frameTicksEnabled (false)
+	{
+		if(view)
+		{
+			view->queryInterface (IPlugViewRendering::iid, reinterpret_cast<void**> (&rendering));
+			view->queryInterface (IPlugViewRendering2::iid, reinterpret_cast<void**> (&rendering2));
+			view->queryInterface (IPlugViewFrameTick::iid, reinterpret_cast<void**> (&frameTick));
+		}
+	}
+
+	~PlugRenderingFrame ()
+	{
+		if(rendering)
+			rendering->release ();
+		if(rendering2)
+			rendering2->release ();
+		if(frameTick)
+			frameTick->release ();
+	}
+
+	/** Check if a frame has to be rendered with the next display refresh. */
+	bool needsRefresh () const { return !region.isEmpty () || (frameTicksEnabled && frameTick); }
+
+	/**	Deliver the frame tick, if enabled, and render all rectangles invalidated since the last frame with a
+		single call to IPlugViewRendering2::renderRegion(), or IPlugViewRendering::render() with their bounding
+		box if the view doesn't support IPlugViewRendering2. Rectangles invalidated during rendering are
+		rendered with the next display refresh. \return result of the render call, kResultFalse if nothing was rendered */
+	Steinberg::tresult onDisplayRefresh (Steinberg::FUnknown* target, Steinberg::int64 frameTime, Steinberg::int64 frameInterval)
+	{
+		if(frameTicksEnabled && frameTick)
+			frameTick->onFrameTick (frameTime, frameInterval);
+
+		if(region.isEmpty () || rendering == nullptr)
+			return Steinberg::kResultFalse;
+
+		PlugViewDirtyRegion pending (region);
+		region.clear ();
+
+		if(rendering2)
+			return rendering2->renderRegion (target, pending.rects, pending.count);
+
+		Steinberg::ViewRect bounds = pending.getBounds ();
+		return rendering->render (target, &bounds);
+	}
+
+	/** Get rectangles to be rendered with the next display refresh. */
+	const PlugViewDirtyRegion& getDirtyRegion () const { return region; }
+
+	// IPlugRenderingFrame
+	Steinberg::tresult PLUGIN_API invalidateViewRect (Steinberg::ViewRect* dirtyRect)
+	{
+		if(dirtyRect == nullptr)
+			return Steinberg::kInvalidArgument;
+		region.addRect (*dirtyRect);
+		return Steinberg::kResultOk;
+	}
+
+	// IPlugRenderingFrame2
+	Steinberg::tresult PLUGIN_API enableFrameTicks (Steinberg::TBool state)
+	{
+		frameTicksEnabled = state != 0;
+		return frameTick ? Steinberg::kResultOk : Steinberg::kNotImplemented;
+	}
+
+	// FUnknown
+	Steinberg::tresult PLUGIN_API queryInterface (const Steinberg::TUID _iid, void** obj)
+	{
+		QUERY_INTERFACE (_iid, obj, Steinberg::FUnknown::iid, IPlugRenderingFrame2)
+		QUERY_INTERFACE (_iid, obj, IPlugRenderingFrame::iid, IPlugRenderingFrame)
+		QUERY_INTERFACE (_iid, obj, IPlugRenderingFrame2::iid, IPlugRenderingFrame2)
+		*obj = nullptr;
+		return Steinberg::kNoInterface;
+	}
+
+	Steinberg::uint32 PLUGIN_API addRef () { return 1; }
+	Steinberg::uint32 PLUGIN_API release () { return 1; }
+
+protected:
+	IPlugViewRendering* rendering;
+	IPlugViewRendering2* rendering2;
+	IPlugViewFrameTick* frameTick;
+	bool frameTicksEnabled;
+	PlugViewDirtyRegion region;
+};
+
+} // namespace Presonus
+
+#endif // _pslrenderingframe_h
\ No newline at end of file
@@ -0,0 +1,139 @@
+//************************************************************************************************
+//
+// PreSonus Plug-In Extensions
+// Written and placed in the PUBLIC DOMAIN by PreSonus Software Ltd.
+//
+// Filename    : pslrendertrace.h
+// Created by  : PreSonus Software Ltd., 10/2026
+// Description : Render Trace Helpers
+//
+//************************************************************************************************
+/*
+	DISCLAIMER:
+	PreSonus Plug-In Extensions are host-specific extensions of existing proprietary technologies,
+	provided to the community on an AS IS basis. They are not part of any official 3rd party SDK and
+	PreSonus is not affiliated with the owner of the underlying technology in any way.
+*/
+//************************************************************************************************
+
+#ifndef _pslrendertrace_h
+#define _pslrendertrace_h
+
+#include "ipslviewrendering.h"
+
+#include <cstdio>
+
+namespace Presonus {
+
+/** @defgroup renderTrace Render Trace
+
+Helpers for hosts recording render trace events of plug-in views, see IPlugRenderingStatisticsFrame.
+*/
+
+//************************************************************************************************
+// PlugViewRenderTraceBuffer
+/**	Fixed-size ring buffer for render trace events, keeping the most recent maxEvents entries.
+	Events can be written in Chrome trace event format (JSON) for chrome://tracing or Perfetto,
+	with one track per view instance.
+
+	The buffer is not synchronized. IPlugRenderingStatisticsFrame::addTraceEvent() can be called from
+	any thread and render calls may happen on worker threads, so the host has to serialize all calls
+	to add(), copyTo() and writeChromeTrace() of a buffer, e.g. with one lock per view. To avoid blocking
+	render threads during file output, the host can copy the buffer while holding the lock and write the copy.
+
+	@ingroup renderTrace */
+//************************************************************************************************
+
+template<Steinberg::int32 maxEvents = 4096>
+class PlugViewRenderTraceBuffer
+{
+public:
+	static const Steinberg::int32 kMaxEvents = maxEvents;
+
+	PlugViewRenderTraceBuffer ()
+	: writeIndex (0),
+	  count (0)
+	{}
+
+	/** Remove all events. */
+	void clear () { writeIndex = count = 0; }
+
+	/** Get number of events. */
+	Steinberg::int32 getCount () const { return count; }
+
+	/** Add event, overwriting the oldest one if the buffer is full. */
+	void add (const PlugViewRenderTraceEvent& e)
+	{
+		events[writeIndex] = e;
+		writeIndex = (writeIndex + 1) % kMaxEvents;
+		if(count < kMaxEvents)
+			count++;
+	}
+
+	/** Get event by index in chronological order. */
+	const PlugViewRenderTraceEvent& at (Steinberg::int32 index) const
+	{
+		return events[(writeIndex - count + index + kMaxEvents) % kMaxEvents];
+	}
+
+	/** Copy most recent events in chronological order, e.g. for IPlugRenderingStatisticsFrame::getRenderTrace(). */
+	Steinberg::int32 copyTo (PlugViewRenderTraceEvent* result, Steinberg::int32 max) const
+	{
+		Steinberg::int32 n = max < count ? max : count;
+		for(Steinberg::int32 i = 0; i < n; i++)
+			result[i] = at (count - n + i);
+		return n;
+	}
+
+	/**	Write events as Chrome trace events, separated by commas. The caller writes the enclosing
+		"[" and "]" and can combine the output of multiple views. trackId identifies the view instance,
+		trackName is shown as thread name. Names are escaped as JSON strings. */
+	void writeChromeTrace (FILE* file, Steinberg::int32 processId, Steinberg::int32 trackId, const char* trackName, bool first = true) const
+	{
+		fprintf (file, "%s{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%d,\"tid\":%d,\"args\":{\"name\":",
+				 first ? "" : ",\n", processId, trackId);
+		writeString (file, trackName);
+		fputs ("}}", file);
+
+		static const char* typeNames[] = {"render", "invalidate", "frameTick", "input", "custom"};
+		for(Steinberg::int32 i = 0; i < count; i++)
+		{
+			const PlugViewRenderTraceEvent& e = at (i);
+			const char* name = e.name[0] ? e.name : (e.type >= 0 && e.type <= PlugViewRenderTraceEvent::kCustom) ? typeNames[e.type] : "unknown";
+			fputs (",\n{\"name\":", file);
+			writeString (file, name);
+			fprintf (file, ",\"ph\":\"%s\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%d,\"tid\":%d,\"args\":{\"pixels\":%lld}}",
+					 e.duration > 0 ? "X" : "i", double (e.startTime) / 1000., double (e.duration) / 1000.,
+					 processId, trackId, static_cast<long long> (e.pixels));
+		}
+	}
+
+	/** Write zero-terminated string as quoted JSON string, escaping quotes, backslashes and control characters. */
+	static void writeString (FILE* file, const char* string)
+	{
+		fputc ('"', file);
+		for(const char* c = string ? string : ""; *c != 0; c++)
+		{
+			unsigned char ch = static_cast<unsigned char> (*c);
+			if(ch == '"' || ch == '\\')
+			{
+				fputc ('\\', file);
+				fputc (ch, file);
+			}
+			else if(ch < 0x20)
+				fprintf (file, "\\u%04x", ch);
+			else
+				fputc (ch, file);
+		}
+		fputc ('"', file);
+	}
+
+protected:
+	PlugViewRenderTraceEvent events[kMaxEvents];
+	Steinberg::int32 writeIndex;
+	Steinberg::int32 count;
+};
+
+} // namespace Presonus
+
+#endif // _pslrendertrace_h
\ No newline at end of file